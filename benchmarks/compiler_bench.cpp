@@ -0,0 +1,347 @@
+// cvue_bench : débit du compilateur .cvue sur un corpus synthétique
+//
+//   cvue_bench [--files N] [--nodes N] [--directives P] [--depth N] [--seed N]
+//              [--iterations N] [-j N] [--corpus DIR] [--label NAME]
+//              [--json FILE] [--compare FILE]
+//
+// Chaque phase est mesurée --iterations fois : meilleur temps et médiane, débit
+// en Mo/s et fichiers/s, pic de mémoire allouée (tas) pendant la phase. --json
+// écrit les résultats, --compare affiche les écarts avec un fichier précédent.
+
+#include "corpus_generator.hpp"
+#include "compiler/build_tool.hpp"
+#include "compiler/cvue_compiler.hpp"
+#include "compiler/template_parser.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <sys/resource.h>
+#include <unistd.h>
+
+// -- Suivi des allocations --------------------------------------------------
+// Chaque bloc est précédé de sa taille : le pic est exact, threads compris.
+
+namespace {
+    std::atomic<std::size_t> heapCurrent{0};
+    std::atomic<std::size_t> heapPeak{0};
+    std::atomic<std::size_t> heapAllocations{0};
+
+    constexpr std::size_t HEADER = alignof(std::max_align_t);
+
+    void* trackedAlloc(std::size_t size) {
+        void* block = std::malloc(size + HEADER);
+        if (!block) {
+            return nullptr;
+        }
+        *static_cast<std::size_t*>(block) = size;
+        std::size_t current = heapCurrent.fetch_add(size, std::memory_order_relaxed) + size;
+        std::size_t peak = heapPeak.load(std::memory_order_relaxed);
+        while (current > peak && !heapPeak.compare_exchange_weak(peak, current, std::memory_order_relaxed)) {
+        }
+        heapAllocations.fetch_add(1, std::memory_order_relaxed);
+        return static_cast<char*>(block) + HEADER;
+    }
+
+    void trackedFree(void* ptr) {
+        if (!ptr) {
+            return;
+        }
+        void* block = static_cast<char*>(ptr) - HEADER;
+        heapCurrent.fetch_sub(*static_cast<std::size_t*>(block), std::memory_order_relaxed);
+        std::free(block);
+    }
+}
+
+void* operator new(std::size_t size) {
+    if (void* ptr = trackedAlloc(size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return trackedAlloc(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return trackedAlloc(size);
+}
+
+void operator delete(void* ptr) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { trackedFree(ptr); }
+
+// -- Mesures -------------------------------------------------------------------
+
+namespace {
+    using namespace cppvue;
+
+    struct PhaseResult {
+        std::string name;
+        std::size_t bytes = 0;               // Entrée traitée par itération
+        std::size_t files = 0;
+        std::vector<double> seconds;
+        std::size_t peakHeap = 0;            // Au-dessus de l'occupation avant la phase
+        std::size_t allocations = 0;         // Par itération
+
+        double best() const { return *std::min_element(seconds.begin(), seconds.end()); }
+        double median() const {
+            auto sorted = seconds;
+            std::sort(sorted.begin(), sorted.end());
+            return sorted[sorted.size() / 2];
+        }
+        double mbPerSecond() const { return static_cast<double>(bytes) / 1e6 / best(); }
+        double filesPerSecond() const { return static_cast<double>(files) / best(); }
+    };
+
+    PhaseResult measure(const std::string& name, std::size_t bytes, std::size_t files, std::size_t iterations,
+                        const std::function<void()>& setup, const std::function<void()>& run) {
+        PhaseResult result{name, bytes, files, {}, 0, 0};
+        for (std::size_t i = 0; i < iterations; ++i) {
+            if (setup) {
+                setup();
+            }
+            std::size_t baseline = heapCurrent.load();
+            heapPeak.store(baseline);
+            std::size_t allocationsBefore = heapAllocations.load();
+
+            auto start = std::chrono::steady_clock::now();
+            run();
+            auto elapsed = std::chrono::steady_clock::now() - start;
+
+            result.seconds.push_back(std::chrono::duration<double>(elapsed).count());
+            result.peakHeap = std::max(result.peakHeap, heapPeak.load() - baseline);
+            result.allocations = heapAllocations.load() - allocationsBefore;
+        }
+        return result;
+    }
+
+    // Valeur "mb_per_s" d'une phase dans un JSON écrit par writeJson
+    double previousThroughput(const std::string& json, const std::string& phase) {
+        auto pos = json.find("\"" + phase + "\": {");
+        if (pos == std::string::npos) {
+            return 0;
+        }
+        pos = json.find("\"mb_per_s\":", pos);
+        return pos == std::string::npos ? 0 : std::strtod(json.c_str() + pos + 11, nullptr);
+    }
+
+    long maxRssKb() {
+        rusage usage{};
+        getrusage(RUSAGE_SELF, &usage);
+        return usage.ru_maxrss;
+    }
+
+    void writeJson(std::ostream& out, const std::string& label, const bench::CorpusOptions& options,
+                   std::size_t corpusBytes, std::size_t iterations, const std::vector<PhaseResult>& phases) {
+        out << std::setprecision(6);
+        out << "{\n";
+        out << "  \"label\": \"" << label << "\",\n";
+        out << "  \"timestamp\": " << std::time(nullptr) << ",\n";
+        out << "  \"compiler_version\": \"" << compiler::COMPILER_VERSION << "\",\n";
+        out << "  \"corpus\": {\"files\": " << options.files << ", \"nodes_per_template\": " << options.nodesPerTemplate
+            << ", \"directive_density\": " << options.directiveDensity << ", \"max_depth\": " << options.maxDepth
+            << ", \"seed\": " << options.seed << ", \"bytes\": " << corpusBytes << "},\n";
+        out << "  \"iterations\": " << iterations << ",\n";
+        out << "  \"phases\": {\n";
+        for (std::size_t i = 0; i < phases.size(); ++i) {
+            const auto& phase = phases[i];
+            out << "    \"" << phase.name << "\": {\"bytes\": " << phase.bytes << ", \"files\": " << phase.files
+                << ", \"best_s\": " << phase.best() << ", \"median_s\": " << phase.median()
+                << ", \"mb_per_s\": " << phase.mbPerSecond() << ", \"files_per_s\": " << phase.filesPerSecond()
+                << ", \"peak_heap_bytes\": " << phase.peakHeap << ", \"allocations\": " << phase.allocations << "}"
+                << (i + 1 < phases.size() ? ",\n" : "\n");
+        }
+        out << "  },\n";
+        out << "  \"max_rss_kb\": " << maxRssKb() << "\n";
+        out << "}\n";
+    }
+
+    void printUsage() {
+        std::cerr << "usage: cvue_bench [--files N] [--nodes N] [--directives P] [--depth N] [--seed N]\n"
+                     "                  [--iterations N] [-j N] [--corpus DIR] [--label NAME]\n"
+                     "                  [--json FILE] [--compare FILE]\n";
+    }
+}
+
+int main(int argc, char** argv) {
+    bench::CorpusOptions options;
+    std::size_t iterations = 5;
+    unsigned jobs = 0;
+    std::filesystem::path corpusDir;
+    std::string label = "local";
+    std::string jsonPath;
+    std::string comparePath;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--files" && hasValue) {
+            options.files = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--nodes" && hasValue) {
+            options.nodesPerTemplate = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--directives" && hasValue) {
+            options.directiveDensity = std::strtod(argv[++i], nullptr);
+        } else if (arg == "--depth" && hasValue) {
+            options.maxDepth = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--seed" && hasValue) {
+            options.seed = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--iterations" && hasValue) {
+            iterations = std::max<std::size_t>(1, std::strtoul(argv[++i], nullptr, 10));
+        } else if (arg == "-j" && hasValue) {
+            jobs = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (arg == "--corpus" && hasValue) {
+            corpusDir = argv[++i];
+        } else if (arg == "--label" && hasValue) {
+            label = argv[++i];
+        } else if (arg == "--json" && hasValue) {
+            jsonPath = argv[++i];
+        } else if (arg == "--compare" && hasValue) {
+            comparePath = argv[++i];
+        } else if (arg == "-h" || arg == "--help") {
+            printUsage();
+            return 0;
+        } else {
+            std::cerr << "cvue_bench: unknown option " << arg << "\n";
+            printUsage();
+            return 2;
+        }
+    }
+
+    try {
+        auto corpus = bench::CorpusGenerator(options).generate();
+
+        // Corpus conservé si --corpus, sinon dans un répertoire temporaire
+        bool keepCorpus = !corpusDir.empty();
+        auto workDir = std::filesystem::temp_directory_path() / ("cvue-bench-" + std::to_string(::getpid()));
+        if (!keepCorpus) {
+            corpusDir = workDir / "src";
+        }
+        bench::CorpusGenerator::write(corpus, corpusDir);
+
+        std::vector<compiler::CvueFileContent> contents;
+        std::size_t corpusBytes = 0, templateBytes = 0, styleBytes = 0;
+        for (const auto& file : corpus) {
+            contents.push_back(compiler::CvueCompiler::parseCvueFile(file.content));
+            corpusBytes += file.content.size();
+            templateBytes += contents.back().template_content.size();
+            styleBytes += contents.back().style_content.size();
+        }
+        std::vector<compiler::TemplateAst> asts;
+        for (const auto& content : contents) {
+            asts.push_back(compiler::TemplateParser::parse(content.template_content));
+        }
+
+        std::size_t files = corpus.size();
+        std::size_t sink = 0;  // Empêche l'élimination des résultats
+        std::vector<PhaseResult> phases;
+
+        phases.push_back(measure("split", corpusBytes, files, iterations, nullptr, [&] {
+            for (const auto& file : corpus) {
+                sink += compiler::CvueCompiler::parseCvueFile(file.content).template_content.size();
+            }
+        }));
+        phases.push_back(measure("template_parse", templateBytes, files, iterations, nullptr, [&] {
+            for (const auto& content : contents) {
+                sink += compiler::TemplateParser::parse(content.template_content).nodeCount();
+            }
+        }));
+        phases.push_back(measure("codegen", templateBytes, files, iterations, nullptr, [&] {
+            for (std::size_t i = 0; i < files; ++i) {
+                sink += compiler::TemplateParser::generateTemplateRegistrations(asts[i].root()).size();
+                sink += compiler::TemplateParser::generateRenderFunction(asts[i].root(), corpus[i].name).size();
+            }
+        }));
+        phases.push_back(measure("component", corpusBytes, files, iterations, nullptr, [&] {
+            for (std::size_t i = 0; i < files; ++i) {
+                sink += compiler::CvueCompiler::generateCppCode(contents[i], corpus[i].name, "0000abcd").size();
+            }
+        }));
+        phases.push_back(measure("css", styleBytes, files, iterations, nullptr, [&] {
+            for (const auto& content : contents) {
+                sink += compiler::CvueCompiler::generateCssCode(content, "0000abcd").size();
+            }
+        }));
+        phases.push_back(measure("css_minify", styleBytes, files, iterations, nullptr, [&] {
+            for (const auto& content : contents) {
+                sink += compiler::CvueCompiler::generateCssCode(content, "0000abcd", true).size();
+            }
+        }));
+
+        // BuildTool complet : graphe, cache, écriture atomique, bundles CSS
+        compiler::BuildConfig config;
+        config.sourceDir = corpusDir;
+        config.buildDir = workDir / "build";
+        config.outputDir = config.buildDir;
+        config.projectName = "bench";
+        config.jobs = jobs;
+        auto cleanBuild = [&] { std::filesystem::remove_all(config.buildDir); };
+
+        phases.push_back(measure("build_cold", corpusBytes, files, iterations, cleanBuild, [&] {
+            compiler::BuildTool tool(config);
+            tool.generateBuildFiles();
+            tool.buildComponents();
+        }));
+        phases.push_back(measure("build_noop", corpusBytes, files, iterations, nullptr, [&] {
+            compiler::BuildTool tool(config);
+            tool.buildComponents();
+        }));
+
+        std::filesystem::remove_all(keepCorpus ? config.buildDir : workDir);
+
+        // Rapport
+        std::string previous;
+        if (!comparePath.empty()) {
+            std::ifstream in(comparePath);
+            std::stringstream buffer;
+            buffer << in.rdbuf();
+            previous = buffer.str();
+        }
+
+        std::cout << "corpus: " << files << " files, " << std::fixed << std::setprecision(2)
+                  << corpusBytes / 1e6 << " MB (seed " << options.seed << "), " << iterations << " iterations\n";
+        std::cout << std::left << std::setw(16) << "phase" << std::right << std::setw(10) << "best ms"
+                  << std::setw(10) << "MB/s" << std::setw(11) << "files/s" << std::setw(12) << "peak KiB"
+                  << std::setw(10) << "allocs" << (previous.empty() ? "" : "    vs base") << "\n";
+        for (const auto& phase : phases) {
+            std::cout << std::left << std::setw(16) << phase.name << std::right << std::setprecision(2)
+                      << std::setw(10) << phase.best() * 1e3 << std::setw(10) << phase.mbPerSecond()
+                      << std::setw(11) << std::setprecision(0) << phase.filesPerSecond()
+                      << std::setw(12) << phase.peakHeap / 1024 << std::setw(10) << phase.allocations;
+            double base = previous.empty() ? 0 : previousThroughput(previous, phase.name);
+            if (base > 0) {
+                std::cout << std::setprecision(1) << std::showpos << std::setw(10)
+                          << (phase.mbPerSecond() / base - 1) * 100 << "%" << std::noshowpos;
+            }
+            std::cout << "\n";
+        }
+        std::cout << "max RSS: " << maxRssKb() / 1024 << " MiB\n";
+
+        if (!jsonPath.empty()) {
+            std::ofstream out(jsonPath);
+            writeJson(out, label, options, corpusBytes, iterations, phases);
+        }
+        return sink == 0 ? 1 : 0;
+    } catch (const std::exception& e) {
+        std::cerr << "cvue_bench: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -0,0 +1,252 @@
+#include "corpus_generator.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+namespace cppvue::bench {
+
+namespace {
+    const char* const CONTAINER_TAGS[] = {"div", "section", "article", "header", "footer", "nav", "ul", "label"};
+    const char* const LEAF_TAGS[] = {"span", "p", "button", "a", "strong", "em", "h2", "input"};
+    const char* const WORDS[] = {"Dashboard", "Settings", "Profile", "Orders", "Search", "Total",
+                                 "Status", "Details", "Save", "Cancel", "Next", "Previous"};
+    const char* const PROPERTIES[] = {"padding: 4px 8px", "margin: 0 auto", "color: #333",
+                                      "display: flex", "gap: 12px", "font-weight: 600",
+                                      "border: 1px solid #e0e0e0", "background: url(\"bg.png\") no-repeat",
+                                      "transition: opacity 0.2s ease-in", "grid-template-columns: repeat(3, 1fr)"};
+
+    template<typename T, std::size_t N>
+    constexpr std::size_t countOf(const T (&)[N]) { return N; }
+
+    std::string componentName(std::size_t index) {
+        char name[32];
+        std::snprintf(name, sizeof(name), "Cmp%04zu", index);
+        return name;
+    }
+}
+
+CorpusGenerator::CorpusGenerator(CorpusOptions options)
+    : options_(options), state_(options.seed ? options.seed : 0x9E3779B97F4A7C15ULL) {}
+
+std::uint64_t CorpusGenerator::next() {
+    state_ ^= state_ >> 12;
+    state_ ^= state_ << 25;
+    state_ ^= state_ >> 27;
+    return state_ * 0x2545F4914F6CDD1DULL;
+}
+
+std::size_t CorpusGenerator::below(std::size_t bound) {
+    return bound ? static_cast<std::size_t>(next() % bound) : 0;
+}
+
+bool CorpusGenerator::chance(double probability) {
+    return static_cast<double>(next() >> 11) * 0x1.0p-53 < probability;
+}
+
+std::vector<CorpusFile> CorpusGenerator::generate() {
+    std::vector<CorpusFile> corpus;
+    corpus.reserve(options_.files);
+    for (std::size_t i = 0; i < options_.files; ++i) {
+        corpus.push_back({componentName(i), component(i)});
+    }
+    return corpus;
+}
+
+std::string CorpusGenerator::sharedHeader() {
+    return "#pragma once\n\n"
+           "#include <string>\n\n"
+           "namespace bench {\n\n"
+           "struct Row {\n"
+           "    int id = 0;\n"
+           "    std::string label;\n"
+           "    bool selected = false;\n"
+           "    int score = 0;\n"
+           "};\n\n"
+           "} // namespace bench\n";
+}
+
+void CorpusGenerator::write(const std::vector<CorpusFile>& corpus, const std::filesystem::path& dir) {
+    std::filesystem::create_directories(dir / "shared");
+    auto writeText = [](const std::filesystem::path& path, const std::string& content) {
+        std::ofstream file(path, std::ios::binary);
+        if (!file.write(content.data(), static_cast<std::streamsize>(content.size()))) {
+            throw std::runtime_error("Cannot write " + path.string());
+        }
+    };
+    writeText(dir / "shared" / "model.hpp", sharedHeader());
+    for (const auto& file : corpus) {
+        writeText(dir / (file.name + ".cvue"), file.content);
+    }
+}
+
+std::string CorpusGenerator::component(std::size_t index) {
+    index_ = index;
+    classes_.clear();
+    children_.clear();
+    std::string name = componentName(index);
+
+    std::string out = "<template>\n  <div class=\"" + name + "\">\n";
+    std::size_t budget = std::max<std::size_t>(options_.nodesPerTemplate, 1);
+    while (budget > 0) {
+        element(out, 2, budget, false);
+    }
+    out += "  </div>\n</template>\n\n";
+
+    // Enfants inclus comme dans examples/todo : arêtes #include du graphe
+    std::sort(children_.begin(), children_.end());
+    children_.erase(std::unique(children_.begin(), children_.end()), children_.end());
+    out += "<script>\n"
+           "#include <cppvue/reactive.hpp>\n"
+           "#include \"shared/model.hpp\"\n";
+    for (const auto& child : children_) {
+        out += "#include \"" + child + ".cvue\"\n";
+    }
+    out += "#include <memory>\n"
+           "#include <string>\n"
+           "#include <vector>\n\n"
+           "class " + name + " : public cppvue::Component {\n"
+           "public:\n"
+           "    void increment() { ++clicks; }\n"
+           "    void select(int id) { selectedId = id; }\n"
+           "    void toggle() { active = !active; }\n\n"
+           "private:\n"
+           "    std::shared_ptr<cppvue::Reactive<std::string>> title = std::make_shared<cppvue::Reactive<std::string>>(\"" + name + "\");\n"
+           "    std::shared_ptr<cppvue::Reactive<std::string>> query = std::make_shared<cppvue::Reactive<std::string>>(\"\");\n"
+           "    std::shared_ptr<cppvue::Reactive<int>> count = std::make_shared<cppvue::Reactive<int>>(0);\n"
+           "    std::shared_ptr<cppvue::Reactive<bool>> visible = std::make_shared<cppvue::Reactive<bool>>(true);\n"
+           "    std::vector<bench::Row> rows;\n"
+           "    bool active = false;\n"
+           "    int clicks = 0;\n"
+           "    int selectedId = -1;\n"
+           "};\n"
+           "</script>\n\n";
+
+    out += style(index);
+    return out;
+}
+
+void CorpusGenerator::element(std::string& out, std::size_t depth, std::size_t& budget, bool inLoop) {
+    --budget;
+    std::string indent(depth * 2, ' ');
+
+    // Composant enfant d'indice inférieur : le graphe reste acyclique
+    if (index_ > 0 && chance(0.04)) {
+        std::string child = componentName(below(index_));
+        children_.push_back(child);
+        out += indent + "<" + child + " :title=\"title\" @change=\"increment()\"/>\n";
+        return;
+    }
+
+    bool container = depth < options_.maxDepth && budget > 0 && chance(0.45);
+    std::string tag = container ? CONTAINER_TAGS[below(countOf(CONTAINER_TAGS))]
+                                : LEAF_TAGS[below(countOf(LEAF_TAGS))];
+
+    std::string attributes;
+    if (chance(0.6)) {
+        std::string cssClass = "c" + std::to_string(below(24));
+        classes_.push_back(cssClass);
+        attributes += " class=\"" + cssClass + "\"";
+    }
+
+    bool loop = false;
+    if (chance(options_.directiveDensity)) {
+        switch (below(tag == "input" ? 1 : 6)) {
+            case 0:
+                attributes += tag == "input" ? " v-model=\"query\"" : " v-show=\"active\"";
+                break;
+            case 1:
+                attributes += " v-if=\"visible\"";
+                break;
+            case 2:
+                if (!inLoop && container) {
+                    attributes += " v-for=\"(row, idx) in rows\" :key=\"row.id\"";
+                    loop = true;
+                } else {
+                    attributes += " :class=\"{ active: active }\"";
+                }
+                break;
+            case 3:
+                attributes += inLoop ? " :class=\"{ selected: row.selected, odd: idx % 2 === 1 }\""
+                                     : " :class=\"{ active: active }\"";
+                break;
+            case 4:
+                attributes += inLoop ? " @click=\"select(row.id)\"" : " @click=\"increment()\"";
+                break;
+            default:
+                attributes += inLoop ? " :title=\"row.label\"" : " :title=\"title\"";
+                break;
+        }
+    }
+
+    if (tag == "input") {
+        out += indent + "<input type=\"text\"" + attributes + " placeholder=\"" + WORDS[below(countOf(WORDS))] + "\">\n";
+        return;
+    }
+
+    out += indent + "<" + tag + attributes + ">";
+    if (!container) {
+        // Texte statique mêlé d'interpolations
+        bool scoped = inLoop || loop;
+        switch (below(4)) {
+            case 0:
+                out += WORDS[below(countOf(WORDS))];
+                break;
+            case 1:
+                out += scoped ? "{{ row.label }}" : "{{ title }}";
+                break;
+            case 2:
+                out += std::string(WORDS[below(countOf(WORDS))]) + ": " + (scoped ? "{{ row.score }}" : "{{ count }}");
+                break;
+            default:
+                out += scoped ? "#{{ idx + 1 }} {{ row.label }}" : "{{ count }} / {{ query }}";
+                break;
+        }
+        out += "</" + tag + ">\n";
+        return;
+    }
+
+    out += "\n";
+    std::size_t children = 1 + below(4);
+    for (std::size_t i = 0; i < children && budget > 0; ++i) {
+        element(out, depth + 1, budget, inLoop || loop);
+    }
+    out += indent + "</" + tag + ">\n";
+}
+
+std::string CorpusGenerator::style(std::size_t index) {
+    std::sort(classes_.begin(), classes_.end());
+    classes_.erase(std::unique(classes_.begin(), classes_.end()), classes_.end());
+
+    std::string out = "<style scoped>\n";
+    out += "." + componentName(index) + " {\n    display: block;\n}\n\n";
+    auto rule = [&](const std::string& selector) {
+        out += selector + " {\n";
+        std::size_t count = 1 + below(4);
+        for (std::size_t i = 0; i < count; ++i) {
+            out += std::string("    ") + PROPERTIES[below(countOf(PROPERTIES))] + ";\n";
+        }
+        out += "}\n\n";
+    };
+
+    for (const auto& cssClass : classes_) {
+        rule("." + cssClass);
+        if (chance(0.3)) {
+            rule("." + cssClass + ":hover, ." + cssClass + ".active");
+        }
+        if (chance(0.2)) {
+            rule("." + cssClass + " > span + strong");
+        }
+    }
+    if (!classes_.empty()) {
+        out += "/* Mise en page étroite */\n@media (max-width: 600px) {\n";
+        for (std::size_t i = 0; i < std::min<std::size_t>(classes_.size(), 3); ++i) {
+            out += "    ." + classes_[i] + " {\n        padding: 0;\n    }\n";
+        }
+        out += "}\n";
+    }
+    out += "</style>\n";
+    return out;
+}
+
+} // namespace cppvue::bench
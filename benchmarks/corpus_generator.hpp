@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace cppvue::bench {
+
+struct CorpusOptions {
+    std::size_t files = 200;            // Nombre de composants
+    std::size_t nodesPerTemplate = 60;  // Éléments par template (hors texte)
+    double directiveDensity = 0.4;      // Probabilité qu'un élément porte une directive
+    std::size_t maxDepth = 8;           // Profondeur d'imbrication maximale
+    std::uint64_t seed = 1;             // Même graine, même corpus, sur toute plateforme
+};
+
+struct CorpusFile {
+    std::string name;                   // Nom de classe, aussi nom du fichier (<name>.cvue)
+    std::string content;
+};
+
+// Corpus .cvue synthétique mais représentatif : templates imbriqués avec
+// interpolations, v-if/v-for/v-model/v-show, bindings et handlers, composants
+// enfants (graphe de dépendances acyclique), script et <style scoped> avec @media.
+// Les composants incluent un en-tête commun du corpus (shared/model.hpp).
+class CorpusGenerator {
+public:
+    explicit CorpusGenerator(CorpusOptions options);
+
+    std::vector<CorpusFile> generate();
+
+    // Écrit le corpus et son en-tête commun dans dir
+    static void write(const std::vector<CorpusFile>& corpus, const std::filesystem::path& dir);
+
+    static std::string sharedHeader();
+
+private:
+    std::string component(std::size_t index);
+    void element(std::string& out, std::size_t depth, std::size_t& budget, bool inLoop);
+    std::string style(std::size_t index);
+
+    // xorshift64* : les distributions de <random> varient d'une bibliothèque standard à l'autre
+    std::uint64_t next();
+    std::size_t below(std::size_t bound);
+    bool chance(double probability);
+
+    CorpusOptions options_;
+    std::uint64_t state_;
+    std::size_t index_ = 0;
+    std::vector<std::string> classes_;  // Classes CSS utilisées par le template courant
+    std::vector<std::string> children_; // Composants enfants du template courant
+};
+
+} // namespace cppvue::bench
@@ -0,0 +1,22 @@
+#include "arena.hpp"
+#include <algorithm>
+
+namespace cppvue::compiler {
+
+namespace {
+    // Les blocs doublent jusqu'à cette taille ; une allocation plus grande a son propre bloc
+    constexpr std::size_t MAX_BLOCK_SIZE = 64 * 1024;
+}
+
+void* Arena::allocateSlow(std::size_t size, std::size_t alignment) {
+    std::size_t blockSize = std::max(nextBlockSize_, size + alignment);
+    nextBlockSize_ = std::min(nextBlockSize_ * 2, MAX_BLOCK_SIZE);
+
+    blocks_.push_back(std::make_unique_for_overwrite<std::byte[]>(blockSize));
+    reserved_ += blockSize;
+    cursor_ = blocks_.back().get();
+    end_ = cursor_ + blockSize;
+    return allocate(size, alignment);
+}
+
+} // namespace cppvue::compiler
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cppvue::compiler {
+
+// Allocateur par blocs pour les données d'un seul fichier (AST du template) :
+// une allocation est un déplacement de pointeur, tout est libéré avec l'arène.
+// Les objets doivent être trivialement destructibles, aucun destructeur n'est appelé.
+// Déplaçable : les blocs ne bougent pas, les pointeurs restent valides.
+class Arena {
+public:
+    explicit Arena(std::size_t firstBlockSize = 4096) : nextBlockSize_(firstBlockSize) {}
+
+    Arena(Arena&&) noexcept = default;
+    Arena& operator=(Arena&&) noexcept = default;
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    void* allocate(std::size_t size, std::size_t alignment) {
+        auto address = reinterpret_cast<std::uintptr_t>(cursor_);
+        auto aligned = (address + alignment - 1) & ~(alignment - 1);
+        if (cursor_ == nullptr || aligned + size > reinterpret_cast<std::uintptr_t>(end_)) {
+            return allocateSlow(size, alignment);
+        }
+        cursor_ = reinterpret_cast<std::byte*>(aligned + size);
+        used_ += size;
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    template<typename T, typename... Args>
+    T* create(Args&&... args) {
+        static_assert(std::is_trivially_destructible_v<T>, "Arena objects are never destroyed");
+        return new (allocate(sizeof(T), alignof(T))) T{std::forward<Args>(args)...};
+    }
+
+    // Copie de count éléments dans l'arène
+    template<typename T>
+    T* copyArray(const T* data, std::size_t count) {
+        static_assert(std::is_trivially_copyable_v<T>, "Arena arrays are copied bytewise");
+        if (count == 0) {
+            return nullptr;
+        }
+        auto* result = static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+        std::memcpy(static_cast<void*>(result), data, sizeof(T) * count);
+        return result;
+    }
+
+    std::string_view copyString(std::string_view text) {
+        return {copyArray(text.data(), text.size()), text.size()};
+    }
+
+    // Octets alloués / réservés (blocs), pour les mesures mémoire
+    std::size_t bytesUsed() const { return used_; }
+    std::size_t bytesReserved() const { return reserved_; }
+
+private:
+    void* allocateSlow(std::size_t size, std::size_t alignment);
+
+    std::vector<std::unique_ptr<std::byte[]>> blocks_;
+    std::byte* cursor_ = nullptr;
+    std::byte* end_ = nullptr;
+    std::size_t nextBlockSize_;
+    std::size_t used_ = 0;
+    std::size_t reserved_ = 0;
+};
+
+} // namespace cppvue::compiler
@@ -0,0 +1,164 @@
+#include "build_cache.hpp"
+#include "cvue_compiler.hpp"
+#include "file_io.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+namespace cppvue::compiler {
+
+namespace {
+    // En-tête du fichier : un changement de format ou de compilateur invalide tout
+    const std::string CACHE_HEADER = std::string("cvue-cache 1 ") + COMPILER_VERSION;
+
+    std::uint64_t mix(std::uint64_t v) {
+        v ^= v >> 33;
+        v *= 0xff51afd7ed558ccdULL;
+        v ^= v >> 33;
+        v *= 0xc4ceb9fe1a85ec53ULL;
+        v ^= v >> 33;
+        return v;
+    }
+
+    std::uint64_t rotl(std::uint64_t v, int r) {
+        return (v << r) | (v >> (64 - r));
+    }
+
+    std::string toHex(std::uint64_t value) {
+        char buffer[17];
+        std::snprintf(buffer, sizeof(buffer), "%016llx", static_cast<unsigned long long>(value));
+        return buffer;
+    }
+}
+
+BuildCache::BuildCache(std::filesystem::path file)
+    : file_(std::move(file)) {}
+
+std::uint64_t BuildCache::hashBytes(std::string_view data, std::uint64_t seed) {
+    std::uint64_t h = seed ^ (data.size() * 0x9e3779b97f4a7c15ULL);
+    const char* p = data.data();
+    std::size_t remaining = data.size();
+
+    while (remaining >= 8) {
+        std::uint64_t word;
+        std::memcpy(&word, p, 8);
+        h = rotl(h ^ mix(word), 27) * 0x9e3779b97f4a7c15ULL;
+        p += 8;
+        remaining -= 8;
+    }
+    if (remaining > 0) {
+        std::uint64_t word = 0;
+        std::memcpy(&word, p, remaining);
+        h = rotl(h ^ mix(word), 27) * 0x9e3779b97f4a7c15ULL;
+    }
+
+    return mix(h ^ data.size());
+}
+
+std::uint64_t BuildCache::hashFile(const std::filesystem::path& path) {
+    MappedFile file(path);
+    return hashBytes(file.view());
+}
+
+void BuildCache::load() {
+    entries_.clear();
+    dirty_ = false;
+
+    std::ifstream file(file_);
+    std::string line;
+    if (!file || !std::getline(file, line) || line != CACHE_HEADER) {
+        // Pas de cache exploitable : tout sera recompilé puis enregistré
+        dirty_ = true;
+        return;
+    }
+
+    // <hash source> <hash options> <clé>
+    while (std::getline(file, line)) {
+        std::istringstream fields(line);
+        std::string source, options;
+        if (!(fields >> source >> options)) {
+            continue;
+        }
+        std::string key;
+        std::getline(fields >> std::ws, key);
+        if (key.empty()) {
+            continue;
+        }
+
+        Entry entry;
+        try {
+            entry.sourceHash = std::stoull(source, nullptr, 16);
+            entry.optionsHash = std::stoull(options, nullptr, 16);
+        } catch (const std::exception&) {
+            // Ligne corrompue : le composant sera simplement recompilé
+            dirty_ = true;
+            continue;
+        }
+        entries_[key] = entry;
+    }
+}
+
+void BuildCache::save() {
+    if (!dirty_) {
+        return;
+    }
+
+    std::vector<const std::pair<const std::string, Entry>*> sorted;
+    for (const auto& entry : entries_) {
+        sorted.push_back(&entry);
+    }
+    std::sort(sorted.begin(), sorted.end(),
+              [](const auto* a, const auto* b) { return a->first < b->first; });
+
+    std::string content = CACHE_HEADER + "\n";
+    for (const auto* entry : sorted) {
+        content += toHex(entry->second.sourceHash) + " " + toHex(entry->second.optionsHash) +
+                   " " + entry->first + "\n";
+    }
+
+    writeFileAtomic(file_, content);
+    dirty_ = false;
+}
+
+bool BuildCache::isFresh(const std::string& key, std::uint64_t sourceHash, std::uint64_t optionsHash) const {
+    auto it = entries_.find(key);
+    return it != entries_.end() &&
+           it->second.sourceHash == sourceHash &&
+           it->second.optionsHash == optionsHash;
+}
+
+void BuildCache::record(const std::string& key, std::uint64_t sourceHash, std::uint64_t optionsHash) {
+    auto& entry = entries_[key];
+    if (entry.sourceHash != sourceHash || entry.optionsHash != optionsHash) {
+        entry.sourceHash = sourceHash;
+        entry.optionsHash = optionsHash;
+        dirty_ = true;
+    }
+}
+
+void BuildCache::erase(const std::string& key) {
+    if (entries_.erase(key) > 0) {
+        dirty_ = true;
+    }
+}
+
+std::vector<std::string> BuildCache::collectGarbage(const std::unordered_set<std::string>& liveKeys) {
+    std::vector<std::string> removed;
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        if (liveKeys.count(it->first) == 0) {
+            removed.push_back(it->first);
+            it = entries_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    if (!removed.empty()) {
+        dirty_ = true;
+        std::sort(removed.begin(), removed.end());
+    }
+    return removed;
+}
+
+} // namespace cppvue::compiler
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace cppvue::compiler {
+
+// Cache de build persistant : pour chaque composant, le hash du contenu source
+// et celui des options (version du compilateur incluse) de la dernière
+// compilation réussie. Indépendant des dates de modification.
+class BuildCache {
+public:
+    struct Entry {
+        std::uint64_t sourceHash = 0;
+        std::uint64_t optionsHash = 0;
+    };
+
+    explicit BuildCache(std::filesystem::path file);
+
+    // Charge le cache (absent, illisible ou d'un autre format : cache vide)
+    void load();
+
+    // Écrit le cache s'il a changé depuis le chargement
+    void save();
+
+    bool contains(const std::string& key) const { return entries_.count(key) > 0; }
+    bool isFresh(const std::string& key, std::uint64_t sourceHash, std::uint64_t optionsHash) const;
+    void record(const std::string& key, std::uint64_t sourceHash, std::uint64_t optionsHash);
+    void erase(const std::string& key);
+
+    // Retire les entrées dont la clé n'est plus dans liveKeys ; renvoie les clés retirées
+    std::vector<std::string> collectGarbage(const std::unordered_set<std::string>& liveKeys);
+
+    std::size_t size() const { return entries_.size(); }
+
+    // Hash 64 bits non cryptographique, 8 octets par itération
+    static std::uint64_t hashBytes(std::string_view data, std::uint64_t seed = 0);
+    static std::uint64_t hashFile(const std::filesystem::path& path);
+
+private:
+    std::filesystem::path file_;
+    std::unordered_map<std::string, Entry> entries_;
+    bool dirty_ = false;
+};
+
+} // namespace cppvue::compiler
@@ -1,26 +1,55 @@
 #include "build_tool.hpp"
 #include "cvue_compiler.hpp"
 #include "template_parser.hpp"
+#include "render_codegen.hpp"
+#include "css_processor.hpp"
+#include "perfect_hash.hpp"
+#include "file_io.hpp"
+#include "phase_profiler.hpp"
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
 #include <fstream>
 #include <sstream>
-#include <thread>
-#include <chrono>
-#include <regex>
-#include <queue>
+#include <iostream>
 #include <mutex>
-#include <condition_variable>
+#include <optional>
+#include <tuple>
+#include <cctype>
+#include <unordered_set>
 
 namespace cppvue::compiler {
 
 BuildTool::BuildTool(BuildConfig config)
-    : config_(std::move(config)) {
+    : config_(std::move(config)),
+      cache_(config_.buildDir / ".cvue-cache") {
+    // Composants d'un seul chunk : partagés par plusieurs, ils restent dans le programme
+    if (config_.lazyChunks) {
+        std::unordered_map<std::string, std::size_t> uses;
+        for (const auto& [chunk, names] : config_.routeChunks) {
+            for (const auto& name : names) {
+                if (uses[name]++ == 0) {
+                    lazyChunks_[name] = chunk;
+                } else {
+                    lazyChunks_.erase(name);
+                }
+            }
+        }
+    }
     ensureDirectories();
+    optionsHash_ = computeOptionsHash();
+    cache_.load();
+}
+
+BuildTool::~BuildTool() {
+    stopWatching();
 }
 
 bool BuildTool::generateBuildFiles() {
     try {
         generateCMakeLists();
-        generateComponentRegistry();
+        generateComponentRegistry(findCvueFiles());
         return true;
     } catch (const std::exception& e) {
         throw BuildError("Failed to generate build files: " + std::string(e.what()));
@@ -28,14 +57,10 @@ bool BuildTool::generateBuildFiles() {
 }
 
 void BuildTool::generateCMakeLists() {
-    std::filesystem::path cmakeFile = config_.buildDir / "CMakeLists.txt";
-    std::ofstream file(cmakeFile);
-    
-    if (!file) {
-        throw BuildError("Failed to create CMakeLists.txt");
-    }
+    std::stringstream file;
     
-    file << "cmake_minimum_required(VERSION 3.15)\n\n";
+    // target_precompile_headers demande CMake 3.16
+    file << "cmake_minimum_required(VERSION " << (config_.precompiledHeaders ? "3.16" : "3.15") << ")\n\n";
     file << "project(" << config_.projectName << ")\n\n";
     
     // Configuration C++
@@ -49,19 +74,36 @@ void BuildTool::generateCMakeLists() {
     }
     file << "\n";
     
-    // Sources
+    // Sources ; les composants des chunks chargés à la demande ont leur module
+    auto components = findCvueFiles();
+    std::vector<std::filesystem::path> mainComponents;
+    std::map<std::string, std::vector<std::filesystem::path>> chunkComponents;
+    for (const auto& cvueFile : components) {
+        auto chunk = lazyChunkOf(cvueFile);
+        if (chunk.empty()) {
+            mainComponents.push_back(cvueFile);
+        } else {
+            chunkComponents[chunk].push_back(cvueFile);
+        }
+    }
     file << "set(COMPONENT_SOURCES\n";
-    for (const auto& cvueFile : findCvueFiles()) {
-        auto relativePath = std::filesystem::relative(cvueFile, config_.sourceDir);
-        auto cppFile = config_.buildDir / relativePath.replace_extension(".cpp");
-        file << "    " << cppFile.string() << "\n";
+    if (config_.unityBatchSize > 0) {
+        for (const auto& unitySource : generateUnitySources(mainComponents)) {
+            file << "    " << cmakePath(unitySource) << "\n";
+        }
+    } else {
+        for (const auto& cvueFile : mainComponents) {
+            auto relativePath = std::filesystem::relative(cvueFile, config_.sourceDir);
+            auto cppFile = config_.buildDir / relativePath.replace_extension(".cpp");
+            file << "    " << cppFile.string() << "\n";
+        }
     }
     file << ")\n\n";
     
     // Cible de la bibliothèque
     file << "add_library(" << config_.projectName << " STATIC\n";
     file << "    ${COMPONENT_SOURCES}\n";
-    file << "    ${CMAKE_SOURCE_DIR}/src/component_registry.cpp\n";
+    file << "    ${CMAKE_SOURCE_DIR}/src/component_loader.cpp\n";
     file << ")\n\n";
     
     // Configuration de la cible
@@ -70,182 +112,742 @@ void BuildTool::generateCMakeLists() {
         file << "    ENABLE_HOT_RELOAD\n";
     }
     file << ")\n";
+    
+    // Les en-têtes CppVue (et <regex>, <functional>...) ne sont analysés
+    // qu'une fois pour toute la bibliothèque
+    if (config_.precompiledHeaders) {
+        file << "target_precompile_headers(" << config_.projectName << " PRIVATE "
+             << cmakePath(generatePrecompiledHeader()) << ")\n";
+    }
+    
+    // Profil par unité de traduction (parsing, instanciations...), à côté
+    // des .o ; complète celui de cvuec --time-trace
+    if (config_.timeTrace) {
+        file << "if(CMAKE_CXX_COMPILER_ID MATCHES \"Clang\")\n";
+        file << "    target_compile_options(" << config_.projectName << " PRIVATE -ftime-trace)\n";
+        file << "endif()\n";
+    }
+    
+    // Un module par chunk de route, chargé par cppvue::ModuleLoader à la
+    // première navigation : l'application est liée avec -sMAIN_MODULE=1 (wasm)
+    // ou exporte ses symboles (-rdynamic) pour que le module s'y résolve
+    if (!chunkComponents.empty()) {
+        file << "\nset_target_properties(" << config_.projectName << " PROPERTIES POSITION_INDEPENDENT_CODE ON)\n";
+    }
+    for (const auto& [chunk, members] : chunkComponents) {
+        std::string target = "chunk_" + chunk;
+        file << "\nset(" << target << "_SOURCES\n";
+        for (const auto& cvueFile : members) {
+            file << "    " << cmakePath(outputPath(cvueFile)) << "\n";
+        }
+        file << ")\n";
+        file << "if(EMSCRIPTEN)\n";
+        file << "    add_executable(" << target << " ${" << target << "_SOURCES})\n";
+        file << "    target_link_options(" << target << " PRIVATE -sSIDE_MODULE=1)\n";
+        file << "    set_target_properties(" << target << " PROPERTIES SUFFIX \".wasm\"\n";
+        file << "        RUNTIME_OUTPUT_DIRECTORY ${CMAKE_SOURCE_DIR}/chunks)\n";
+        file << "else()\n";
+        file << "    add_library(" << target << " MODULE ${" << target << "_SOURCES})\n";
+        file << "    set_target_properties(" << target << " PROPERTIES PREFIX \"\" SUFFIX \".so\"\n";
+        file << "        LIBRARY_OUTPUT_DIRECTORY ${CMAKE_SOURCE_DIR}/chunks)\n";
+        file << "endif()\n";
+        file << "set_target_properties(" << target << " PROPERTIES OUTPUT_NAME " << chunk
+             << " POSITION_INDEPENDENT_CODE ON)\n";
+        if (config_.enableHotReload) {
+            file << "target_compile_definitions(" << target << " PRIVATE ENABLE_HOT_RELOAD)\n";
+        }
+        if (config_.precompiledHeaders) {
+            file << "target_precompile_headers(" << target << " PRIVATE "
+                 << cmakePath(generatePrecompiledHeader()) << ")\n";
+        }
+    }
+    
+    // Un module wasm par composant, chargé par le client du hot reload
+    // (l'application est liée avec -sMAIN_MODULE=1)
+    if (config_.enableHotReload) {
+        file << "\nset_target_properties(" << config_.projectName << " PROPERTIES POSITION_INDEPENDENT_CODE ON)\n\n";
+        file << "if(EMSCRIPTEN)\n";
+        for (const auto& cvueFile : components) {
+            std::string target = "hot_" + cvueFile.stem().string();
+            file << "    add_executable(" << target << " " << cmakePath(outputPath(cvueFile)) << ")\n";
+            file << "    target_compile_definitions(" << target << " PRIVATE ENABLE_HOT_RELOAD CPPVUE_HOT_MODULE)\n";
+            file << "    target_link_options(" << target << " PRIVATE -sSIDE_MODULE=1)\n";
+            file << "    set_target_properties(" << target << " PROPERTIES POSITION_INDEPENDENT_CODE ON\n";
+            file << "        OUTPUT_NAME " << cvueFile.stem().string() << " SUFFIX \".wasm\"\n";
+            file << "        RUNTIME_OUTPUT_DIRECTORY ${CMAKE_SOURCE_DIR}/hot)\n";
+        }
+        file << "endif()\n";
+    }
+    
+    // Réécrit à chaque build : inchangé, il ne relance pas la configuration CMake
+    try {
+        writeFileIfChanged(config_.buildDir / "CMakeLists.txt", file.str());
+    } catch (const std::exception& e) {
+        throw BuildError(std::string("Failed to create CMakeLists.txt: ") + e.what());
+    }
 }
 
-void BuildTool::generateComponentRegistry() {
-    // Génère le header
-    {
-        std::ofstream file(config_.buildDir / "include/component_registry.hpp");
-        file << "#pragma once\n\n";
-        file << "#include <cppvue/component.hpp>\n";
-        file << "#include <string>\n";
-        file << "#include <memory>\n\n";
-        file << "namespace " << config_.projectName << " {\n\n";
-        file << "class ComponentRegistry {\n";
-        file << "public:\n";
-        file << "    static ComponentRegistry& instance();\n";
-        file << "    std::shared_ptr<cppvue::Component> createComponent(const std::string& name);\n";
-        file << "    void registerComponent(const std::string& name, std::function<std::shared_ptr<cppvue::Component>()> factory);\n";
-        file << "private:\n";
-        file << "    ComponentRegistry() = default;\n";
-        file << "    std::unordered_map<std::string, std::function<std::shared_ptr<cppvue::Component>()>> factories_;\n";
-        file << "};\n\n";
-        file << "} // namespace " << config_.projectName << "\n";
-    }
-    
-    // Génère l'implémentation
-    {
-        std::ofstream file(config_.buildDir / "src/component_registry.cpp");
-        file << "#include \"component_registry.hpp\"\n\n";
-        file << "namespace " << config_.projectName << " {\n\n";
-        file << "ComponentRegistry& ComponentRegistry::instance() {\n";
-        file << "    static ComponentRegistry registry;\n";
-        file << "    return registry;\n";
-        file << "}\n\n";
-        file << "std::shared_ptr<cppvue::Component> ComponentRegistry::createComponent(const std::string& name) {\n";
-        file << "    auto it = factories_.find(name);\n";
-        file << "    if (it != factories_.end()) {\n";
-        file << "        return it->second();\n";
-        file << "    }\n";
-        file << "    return nullptr;\n";
-        file << "}\n\n";
-        file << "void ComponentRegistry::registerComponent(const std::string& name, std::function<std::shared_ptr<cppvue::Component>()> factory) {\n";
-        file << "    factories_[name] = std::move(factory);\n";
-        file << "}\n\n";
-        file << "} // namespace " << config_.projectName << "\n";
+std::vector<std::vector<std::filesystem::path>> BuildTool::unityBatches(
+        const std::vector<std::filesystem::path>& components) {
+    // generateBuildFiles passe avant buildComponents : graphe pas encore construit
+    if (!std::all_of(components.begin(), components.end(),
+                     [this](const std::filesystem::path& component) { return graph_.contains(component); })) {
+        analyzeDependencies(components);
     }
+    
+    std::unordered_set<std::string> componentKeys;
+    for (const auto& component : components) {
+        componentKeys.insert(component.lexically_normal().generic_string());
+    }
+    
+    // Parcours en profondeur depuis les composants de plus haut niveau : chaque
+    // composant est placé juste après ses enfants, avec qui il partage en-têtes
+    // et instanciations de templates
+    std::vector<std::filesystem::path> ordered;
+    std::unordered_set<std::string> visited;
+    std::function<void(const std::filesystem::path&)> visit = [&](const std::filesystem::path& component) {
+        if (!visited.insert(component.lexically_normal().generic_string()).second) {
+            return;
+        }
+        for (const auto& dependency : graph_.dependencies(component)) {
+            if (componentKeys.count(dependency.lexically_normal().generic_string())) {
+                visit(dependency);
+            }
+        }
+        ordered.push_back(component);
+    };
+    auto order = graph_.topologicalOrder(components);
+    for (auto it = order.rbegin(); it != order.rend(); ++it) {
+        visit(*it);
+    }
+    
+    std::vector<std::vector<std::filesystem::path>> batches;
+    for (std::size_t start = 0; start < ordered.size(); start += config_.unityBatchSize) {
+        auto end = std::min(start + config_.unityBatchSize, ordered.size());
+        batches.emplace_back(ordered.begin() + start, ordered.begin() + end);
+    }
+    return batches;
+}
+
+std::vector<std::filesystem::path> BuildTool::generateUnitySources(
+        const std::vector<std::filesystem::path>& components) {
+    auto unityDir = config_.buildDir / "unity";
+    std::filesystem::create_directories(unityDir);
+    
+    std::vector<std::filesystem::path> sources;
+    auto batches = unityBatches(components);
+    for (std::size_t i = 0; i < batches.size(); ++i) {
+        // Inclusions relatives à l'unité : valables quel que soit le répertoire de build
+        std::string content = "// Généré par cvuec : ne pas modifier\n";
+        for (const auto& component : batches[i]) {
+            content += "#include \"" + outputPath(component).lexically_relative(unityDir).generic_string() + "\"\n";
+        }
+        sources.push_back(unityDir / ("unity_" + std::to_string(i) + ".cpp"));
+        writeFileIfChanged(sources.back(), content);
+    }
+    
+    // Unités d'un découpage précédent (moins de composants, lots plus grands)
+    std::unordered_set<std::string> current;
+    for (const auto& source : sources) {
+        current.insert(source.filename().string());
+    }
+    for (const auto& entry : std::filesystem::directory_iterator(unityDir)) {
+        if (!current.count(entry.path().filename().string())) {
+            std::filesystem::remove(entry.path());
+        }
+    }
+    return sources;
+}
+
+std::filesystem::path BuildTool::generatePrecompiledHeader() {
+    auto path = config_.buildDir / "include" / "cppvue_pch.hpp";
+    writeFileIfChanged(path,
+        "// Généré par cvuec : en-têtes communs aux composants générés\n"
+        "#pragma once\n\n"
+        "#include <cppvue/component.hpp>\n"
+        "#include <cppvue/reactive.hpp>\n"
+        "#include <cppvue/render_helpers.hpp>\n"
+        "#include <cppvue/static_template.hpp>\n"
+        "#ifdef ENABLE_HOT_RELOAD\n"
+        "#include <cppvue/hot_reload.hpp>\n"
+        "#endif\n\n"
+        "#include <functional>\n"
+        "#include <memory>\n"
+        "#include <string>\n"
+        "#include <unordered_map>\n"
+        "#include <vector>\n");
+    return path;
+}
+
+void BuildTool::generateComponentRegistry(const std::vector<std::filesystem::path>& components) {
+    // Identifiants dans l'ordre alphabétique des noms : stables tant que
+    // l'ensemble des composants ne change pas
+    std::vector<std::string> names;
+    std::vector<std::filesystem::path> byName = components;
+    std::sort(byName.begin(), byName.end(), [](const auto& a, const auto& b) { return a.stem() < b.stem(); });
+    for (const auto& cvueFile : byName) {
+        names.push_back(cvueFile.stem().string());
+    }
+    PerfectHash perfectHash;
+    try {
+        perfectHash = PerfectHashBuilder::build(names);
+    } catch (const std::exception& e) {
+        throw BuildError(std::string(e.what()) + " (two components with the same name?)");
+    }
+    
+    std::stringstream file;
+    file << "#pragma once\n\n";
+    file << "#include <cppvue/component.hpp>\n";
+    file << "#include <cppvue/component_table.hpp>\n";
+    file << "#include <cstdint>\n";
+    file << "#include <memory>\n";
+    file << "#include <string_view>\n\n";
+    file << "namespace " << config_.projectName << " {\n\n";
+    
+    // Fabriques définies à la fin du code généré de chaque composant
+    for (const auto& cvueFile : byName) {
+        file << "std::shared_ptr<cppvue::Component> " << factoryName(cvueFile) << "();\n";
+    }
+    
+    file << "\n// Identifiants des composants (bridge wasm : createComponentById)\n";
+    file << "namespace component_id {\n";
+    for (std::size_t id = 0; id < names.size(); ++id) {
+        file << "inline constexpr std::uint32_t " << componentIdentifier(byName[id]) << " = " << id << ";\n";
+    }
+    file << "} // namespace component_id\n\n";
+    
+    // Table de hachage parfait calculée par cvuec (voir cppvue::ComponentTable)
+    if (names.empty()) {
+        file << "inline constexpr cppvue::ComponentTable componentTable{};\n\n";
+    } else {
+        auto list = [&file](const auto& values, const auto& write) {
+            for (std::size_t i = 0; i < values.size(); ++i) {
+                file << (i % 8 == 0 ? "\n    " : " ");
+                write(values[i]);
+                file << ",";
+            }
+            file << "\n};\n";
+        };
+        file << "namespace detail {\n";
+        file << "inline constexpr std::string_view componentNames[] = {";
+        list(names, [&file](const std::string& name) { file << "\"" << name << "\""; });
+        file << "inline constexpr cppvue::ComponentTable::Factory componentFactories[] = {";
+        list(byName, [&file](const std::filesystem::path& cvueFile) { file << "&" << factoryName(cvueFile); });
+        file << "inline constexpr std::int32_t componentDisplacements[] = {";
+        list(perfectHash.displacements, [&file](std::int32_t value) { file << value; });
+        file << "inline constexpr std::uint32_t componentSlots[] = {";
+        list(perfectHash.slots, [&file](std::uint32_t value) { file << value; });
+        file << "} // namespace detail\n\n";
+        file << "inline constexpr cppvue::ComponentTable componentTable{detail::componentNames, detail::componentFactories,\n";
+        file << "    detail::componentDisplacements, detail::componentSlots, " << names.size() << "};\n\n";
+    }
+    
+    file << "class ComponentRegistry {\n";
+    file << "public:\n";
+    file << "    static constexpr const cppvue::ComponentTable& table() { return componentTable; }\n";
+    file << "    static constexpr std::uint32_t idOf(std::string_view name) { return componentTable.idOf(name); }\n";
+    file << "    static std::shared_ptr<cppvue::Component> createComponent(std::string_view name) {\n";
+    file << "        return componentTable.create(name);\n";
+    file << "    }\n";
+    file << "    static std::shared_ptr<cppvue::Component> createComponent(std::uint32_t id) {\n";
+    file << "        return componentTable.create(id);\n";
+    file << "    }\n";
+    file << "};\n\n";
+    file << "// Installe componentTable comme table de l'application (component_loader.cpp)\n";
+    file << "void loadComponents();\n\n";
+    file << "} // namespace " << config_.projectName << "\n";
+    
+    writeFileIfChanged(config_.buildDir / "include/component_registry.hpp", file.str());
 }
 
 bool BuildTool::buildComponents() {
-    bool success = true;
+    std::lock_guard<std::mutex> buildLock(buildMutex_);
     auto components = findCvueFiles();
+    {
+        PhaseScope phase("dependencies");
+        analyzeDependencies(components);
+    }
     
-    // Analyse les dépendances
-    analyzeDependencies();
+    // Un composant est périmé si son source ou l'une de ses dépendances
+    // (composant enfant, en-tête) a changé ; les autres ne sont pas parsés.
+    // Les enfants passent avant leurs parents.
+    std::vector<std::filesystem::path> stale;
+    std::vector<std::uint64_t> hashes;
+    for (const auto& cvueFile : graph_.topologicalOrder(components)) {
+        std::uint64_t hash = graph_.hash(cvueFile);
+        if (needsRecompilation(cvueFile, hash)) {
+            stale.push_back(cvueFile);
+            hashes.push_back(hash);
+        }
+    }
     
-    // Compile chaque composant
-    for (const auto& cvueFile : components) {
-        if (needsRecompilation(cvueFile)) {
-            if (!compileSingleComponent(cvueFile)) {
-                success = false;
-            }
+    // Parsing et génération en parallèle ; chaque tâche n'écrit que ses propres
+    // fichiers et son emplacement dans errors
+    std::vector<std::string> errors(stale.size());
+    if (!stale.empty()) {
+        std::size_t jobs = config_.jobs ? config_.jobs : ThreadPool::defaultThreadCount();
+        ThreadPool pool(std::min(jobs, stale.size()));
+        for (std::size_t i = 0; i < stale.size(); ++i) {
+            pool.submit([this, &stale, &errors, i]() {
+                try {
+                    compileSingleComponent(stale[i]);
+                } catch (const std::exception& e) {
+                    errors[i] = e.what();
+                }
+            });
         }
+        pool.wait();
     }
     
-    if (success) {
-        generateComponentLoader(components);
+    // Suite séquentielle, dans l'ordre des dépendances : résultat déterministe
+    std::string report;
+    std::size_t failed = 0;
+    for (std::size_t i = 0; i < stale.size(); ++i) {
+        if (!errors[i].empty()) {
+            ++failed;
+            report += "\n  " + errors[i];
+            std::lock_guard<std::mutex> lock(cacheMutex_);
+            cache_.erase(cacheKey(stale[i]));
+            continue;
+        }
+        
+        updateDependencyInfo(stale[i], hashes[i]);
     }
     
-    return success;
+    collectStaleOutputs(components);
+    {
+        PhaseScope phase("cache");
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        cache_.save();
+    }
+    
+    if (failed > 0) {
+        throw BuildError(std::to_string(failed) + " of " + std::to_string(stale.size()) +
+                         " components failed to compile:" + report);
+    }
+    
+    PhaseScope phase("registry");
+    generateComponentRegistry(components);
+    generateComponentLoader(components);
+    generateCssBundles(components);
+    return true;
 }
 
 bool BuildTool::compileSingleComponent(const std::filesystem::path& cvueFile) {
+    PhaseScope componentPhase("component", cvueFile);
     try {
-        // Lit le fichier .cvue
-        std::ifstream input(cvueFile);
-        if (!input) {
-            throw BuildError("Failed to open file: " + cvueFile.string());
+        // Source projeté en mémoire : découpé en sections sans copie
+        std::optional<MappedFile> source;
+        {
+            PhaseScope phase("read");
+            source.emplace(cvueFile);
         }
+        auto cppPath = outputPath(cvueFile);
+        auto cssPath = cssOutputPath(cvueFile);
         
-        std::string content((std::istreambuf_iterator<char>(input)),
-                          std::istreambuf_iterator<char>());
+        // Le code généré ne dépend que du source (et des options) : un
+        // composant recompilé pour une dépendance, ou revenu à une version
+        // déjà vue, n'est ni parsé ni régénéré
+        std::uint64_t sourceHash = 0;
+        if (config_.keepGeneratedCode) {
+            sourceHash = BuildCache::hashBytes(source->view());
+            std::lock_guard<std::mutex> lock(generatedMutex_);
+            auto& versions = generated_[cacheKey(cvueFile)];
+            auto it = std::find_if(versions.begin(), versions.end(),
+                [sourceHash](const GeneratedCode& code) { return code.sourceHash == sourceHash; });
+            if (it != versions.end()) {
+                PhaseScope phase("write");
+                writeFileIfChanged(cppPath, it->cpp);
+                writeFileIfChanged(cssPath, it->css);
+                return true;
+            }
+        }
         
-        // Parse le fichier
-        auto cvueContent = CvueCompiler::parseCvueFile(content);
+        // Parse le fichier .cvue
+        CvueFileContent cvueContent;
+        {
+            PhaseScope phase("split");
+            cvueContent = CvueCompiler::parseCvueFile(source->view());
+        }
         
-        // Génère le code C++
+        // Génère le code C++, suivi de la fabrique utilisée par le loader
         std::string className = cvueFile.stem().string();
-        std::string cppCode = CvueCompiler::generateCppCode(cvueContent, className);
+        std::string componentId = generateComponentId(cvueFile);
+        std::string cppCode = CvueCompiler::generateCppCode(cvueContent, className, componentId,
+                                                            config_.compactCode);
+        cppCode += "\n#ifndef CPPVUE_HOT_MODULE\n";
+        auto chunk = lazyChunkOf(cvueFile);
+        if (chunk.empty()) {
+            cppCode += "namespace " + config_.projectName + " {\n";
+            cppCode += "std::shared_ptr<cppvue::Component> " + factoryName(cvueFile) + "() {\n";
+            cppCode += "    return std::make_shared<" + className + ">();\n";
+            cppCode += "}\n";
+            cppCode += "} // namespace " + config_.projectName + "\n";
+        } else {
+            // Module du chunk : la fabrique du registre passe par ModuleLoader
+            cppCode += "#include <cppvue/module_loader.hpp>\n";
+            cppCode += "// Chunk \"" + chunk + "\" : fabrique enregistrée au chargement du module\n";
+            cppCode += "static const bool " + className + "_chunkFactory = cppvue::ModuleLoader::instance().registerFactory(\"" +
+                       className + "\",\n";
+            cppCode += "    []() -> std::shared_ptr<cppvue::Component> { return std::make_shared<" + className + ">(); });\n";
+        }
+        cppCode += "#endif\n";
         
         // Génère le CSS
-        std::string componentId = generateComponentId(cvueFile);
-        std::string cssCode = CvueCompiler::generateCssCode(cvueContent, componentId);
+        std::string cssCode = CvueCompiler::generateCssCode(cvueContent, componentId, config_.minifyCss);
         
         // Écrit les fichiers générés
-        auto outputPath = config_.buildDir / cvueFile.filename().replace_extension(".cpp");
-        auto cssPath = config_.buildDir / cvueFile.filename().replace_extension(".css");
-        
         {
-            std::ofstream cpp(outputPath);
-            if (!cpp) {
-                throw BuildError("Failed to create output file: " + outputPath.string());
-            }
-            cpp << cppCode;
+            PhaseScope phase("write");
+            writeFileIfChanged(cppPath, cppCode);
+            writeFileIfChanged(cssPath, cssCode);
         }
         
-        {
-            std::ofstream css(cssPath);
-            if (!css) {
-                throw BuildError("Failed to create CSS file: " + cssPath.string());
+        if (config_.keepGeneratedCode) {
+            std::lock_guard<std::mutex> lock(generatedMutex_);
+            auto& versions = generated_[cacheKey(cvueFile)];
+            if (versions.size() == GENERATED_VERSIONS) {
+                versions.erase(versions.begin());
             }
-            css << cssCode;
-        }
-        
-        // Met à jour les informations de dépendance
-        updateDependencyInfo(cvueFile);
-        
-        // Notifie le hot reload si activé
-        if (config_.enableHotReload) {
-            notifyHotReload(cvueFile);
+            versions.push_back({sourceHash, std::move(cppCode), std::move(cssCode)});
         }
-        
         return true;
     } catch (const std::exception& e) {
         throw BuildError("Failed to compile " + cvueFile.string() + ": " + e.what());
     }
 }
 
+void BuildTool::generateComponentLoader(const std::vector<std::filesystem::path>& components) {
+    std::stringstream file;
+    file << "#include \"component_registry.hpp\"\n";
+    if (!lazyChunks_.empty()) {
+        file << "#include <cppvue/module_loader.hpp>\n";
+    }
+    file << "\nnamespace " << config_.projectName << " {\n\n";
+    
+    // Le hachage parfait est vérifié à la compilation de l'application
+    for (const auto& cvueFile : components) {
+        file << "static_assert(componentTable.idOf(\"" << cvueFile.stem().string() << "\") == component_id::"
+             << componentIdentifier(cvueFile) << ");\n";
+    }
+    file << "\n";
+    
+    // Composants des chunks chargés à la demande : instance créée par la
+    // fabrique que leur module enregistre (nullptr avant son chargement)
+    std::vector<std::filesystem::path> lazy;
+    for (const auto& cvueFile : components) {
+        if (!lazyChunkOf(cvueFile).empty()) {
+            lazy.push_back(cvueFile);
+            file << "std::shared_ptr<cppvue::Component> " << factoryName(cvueFile) << "() {\n";
+            file << "    return cppvue::ModuleLoader::instance().create(\"" << cvueFile.stem().string() << "\");\n";
+            file << "}\n\n";
+        }
+    }
+    
+    file << "void loadComponents() {\n";
+    file << "    cppvue::ComponentTable::install(&componentTable);\n";
+    for (const auto& cvueFile : lazy) {
+        file << "    cppvue::ModuleLoader::instance().addComponent(\"" << cvueFile.stem().string() << "\", \""
+             << lazyChunkOf(cvueFile) << "\");\n";
+    }
+    file << "}\n\n";
+    file << "} // namespace " << config_.projectName << "\n";
+    
+    writeFileIfChanged(config_.buildDir / "src/component_loader.cpp", file.str());
+}
+
 void BuildTool::watchAndRebuild() {
-    if (!config_.enableHotReload) {
+    if (watcher_) {
         return;
     }
+    if (config_.enableHotReload) {
+        setupHotReload();
+    }
     
-    std::thread([this]() {
-        std::queue<std::filesystem::path> changedFiles;
-        std::mutex mutex;
-        std::condition_variable cv;
-        bool running = true;
-        
-        // Thread de surveillance
-        std::thread watchThread([&]() {
-            while (running) {
-                for (const auto& cvueFile : findCvueFiles()) {
-                    if (needsRecompilation(cvueFile)) {
-                        std::lock_guard<std::mutex> lock(mutex);
-                        changedFiles.push(cvueFile);
-                        cv.notify_one();
-                    }
-                }
-                std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    // Le watcher livre les rafales une par une sur son thread : les
+    // recompilations ne se chevauchent jamais
+    // Les en-têtes du projet aussi : leurs dépendants sont recompilés
+    WatchOptions options;
+    options.extensions = {".cvue", ".hpp", ".h"};
+    watcher_ = std::make_unique<FileWatcher>(config_.sourceDir, options);
+    watcher_->start([this](const std::vector<std::filesystem::path>& changed) {
+        rebuildChanged(changed);
+    });
+}
+
+void BuildTool::stopWatching() {
+    if (watcher_) {
+        watcher_->stop();
+        watcher_.reset();
+    }
+    if (hotServer_) {
+        hotServer_->stop();
+        hotServer_.reset();
+    }
+}
+
+void BuildTool::rebuildChanged(const std::vector<std::filesystem::path>& changed) {
+    for (const auto& error : compileChanged(changed).errors) {
+        std::cerr << error << std::endl;
+    }
+}
+
+BuildReport BuildTool::compileChanged(const std::vector<std::filesystem::path>& changed) {
+    std::lock_guard<std::mutex> buildLock(buildMutex_);
+    BuildReport report;
+    
+    // Fichier ajouté ou supprimé : noms de composants et #include se résolvent
+    // autrement, le graphe est reconstruit. Sinon seuls les fichiers modifiés
+    // sont relus.
+    bool filesChanged = false;
+    for (const auto& file : changed) {
+        if (graph_.contains(file) != std::filesystem::exists(file)) {
+            filesChanged = true;
+        }
+    }
+    
+    std::vector<std::filesystem::path> components;
+    std::vector<std::filesystem::path> candidates;
+    try {
+        if (filesChanged) {
+            components = findCvueFiles();
+            PhaseScope phase("dependencies");
+            analyzeDependencies(components);
+            candidates = components;
+        } else {
+            for (const auto& file : changed) {
+                graph_.update(file);
             }
-        });
+            checkDependencyCycles();
+            candidates = graph_.affected(changed);
+            checkChunkDependencies(candidates);
+        }
+    } catch (const std::exception& e) {
+        report.errors.push_back(e.what());
+        return report;
+    }
+    
+    // Seuls les composants dont le hash combiné a changé sont recompilés
+    // (une sauvegarde sans modification ne coûte rien), enfants d'abord
+    auto& rebuilt = report.compiled;
+    report.checked = candidates.size();
+    for (const auto& file : graph_.topologicalOrder(candidates)) {
+        std::uint64_t hash = graph_.hash(file);
+        if (!needsRecompilation(file, hash)) {
+            continue;
+        }
         
-        // Thread de compilation
-        while (running) {
-            std::unique_lock<std::mutex> lock(mutex);
-            cv.wait(lock, [&]() { return !changedFiles.empty(); });
-            
-            while (!changedFiles.empty()) {
-                auto file = changedFiles.front();
-                changedFiles.pop();
-                lock.unlock();
-                
-                try {
-                    compileSingleComponent(file);
-                } catch (const std::exception& e) {
-                    // Log error
-                }
-                
-                lock.lock();
+        try {
+            compileSingleComponent(file);
+            updateDependencyInfo(file, hash);
+            rebuilt.push_back(file);
+        } catch (const std::exception& e) {
+            report.errors.push_back(e.what());
+            std::lock_guard<std::mutex> lock(cacheMutex_);
+            cache_.erase(cacheKey(file));
+        }
+    }
+    
+    // Sources CMake et loader à régénérer
+    if (filesChanged) {
+        collectStaleOutputs(components);
+        generateCMakeLists();
+        generateComponentRegistry(components);
+        generateComponentLoader(components);
+    }
+    if (filesChanged || !rebuilt.empty()) {
+        generateCssBundles(filesChanged ? components : findCvueFiles());
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        cache_.save();
+    }
+    
+    // Un en-tête, un composant ajouté ou supprimé : la classe compilée dans
+    // l'application a pu changer, seul un rechargement complet convient
+    if (config_.enableHotReload) {
+        bool dependencyChanged = filesChanged || std::any_of(changed.begin(), changed.end(),
+            [](const std::filesystem::path& file) { return file.extension() != ".cvue"; });
+        notifyHotReload(rebuilt, dependencyChanged);
+    }
+    return report;
+}
+
+std::string BuildTool::codeSizeReport() {
+    struct ComponentSize {
+        std::string name;
+        CodeSizeStats stats;
+        std::uintmax_t objectBytes = 0;
+    };
+    
+    // Objets déjà compilés (Composant.cpp.o), quel que soit le répertoire CMake
+    std::unordered_map<std::string, std::uintmax_t> objects;
+    std::error_code ec;
+    for (std::filesystem::recursive_directory_iterator it(config_.buildDir,
+             std::filesystem::directory_options::skip_permission_denied, ec), end;
+         !ec && it != end; it.increment(ec)) {
+        std::string name = it->path().filename().string();
+        for (std::string_view suffix : {".cpp.o", ".cpp.obj"}) {
+            if (name.size() > suffix.size() && name.ends_with(suffix)) {
+                objects[name.substr(0, name.size() - suffix.size())] = it->file_size(ec);
             }
         }
+    }
+    
+    // Régénération en mémoire : rien n'est écrit
+    std::vector<ComponentSize> sizes;
+    std::unordered_map<std::uint64_t, std::pair<std::size_t, std::size_t>> blobUses;  // hash -> taille, composants
+    for (const auto& cvueFile : findCvueFiles()) {
+        ComponentSize size;
+        size.name = cvueFile.stem().string();
+        try {
+            MappedFile source(cvueFile);
+            auto content = CvueCompiler::parseCvueFile(source.view());
+            CvueCompiler::generateCppCode(content, size.name, generateComponentId(cvueFile),
+                                          config_.compactCode, &size.stats);
+        } catch (const std::exception&) {
+            continue;  // Déjà signalé par le build
+        }
+        auto object = objects.find(size.name);
+        if (object != objects.end()) {
+            size.objectBytes = object->second;
+        }
+        for (const auto& [hash, bytes] : size.stats.blobs) {
+            auto& use = blobUses[hash];
+            use.first = bytes;
+            use.second++;
+        }
+        sizes.push_back(std::move(size));
+    }
+    std::sort(sizes.begin(), sizes.end(), [](const ComponentSize& a, const ComponentSize& b) {
+        return std::tie(a.objectBytes, a.stats.renderBytes) > std::tie(b.objectBytes, b.stats.renderBytes);
+    });
+    
+    CodeSizeStats total;
+    std::uintmax_t objectTotal = 0;
+    for (const auto& size : sizes) {
+        total.renderBytes += size.stats.renderBytes;
+        total.elements += size.stats.elements;
+        total.handlers += size.stats.handlers;
+        total.staticNodes += size.stats.staticNodes;
+        objectTotal += size.objectBytes;
+    }
+    std::size_t sharedBlobs = 0;
+    std::size_t savedBytes = 0;
+    for (const auto& [hash, use] : blobUses) {
+        total.staticBytes += use.first;
+        if (use.second > 1) {
+            ++sharedBlobs;
+            savedBytes += use.first * (use.second - 1);
+        }
+    }
+    
+    std::ostringstream out;
+    out << "code size" << (config_.compactCode ? " (compact)" : "") << ": " << sizes.size() << " components, "
+        << total.renderBytes << " B of render code, " << total.elements << " elements, "
+        << total.handlers << " handlers";
+    if (objectTotal > 0) {
+        out << ", " << objectTotal << " B of objects";
+    }
+    out << "\n";
+    if (!blobUses.empty()) {
+        out << "static data: " << blobUses.size() << " blobs, " << total.staticBytes << " B for "
+            << total.staticNodes << " nodes (" << sharedBlobs << " shared, " << savedBytes << " B deduplicated)\n";
+    }
+    
+    char line[160];
+    std::snprintf(line, sizeof(line), "  %-28s %10s %8s %8s %8s %8s %10s\n",
+                  "component", "render B", "elements", "handlers", "static", "data B", "object B");
+    out << line;
+    for (const auto& size : sizes) {
+        std::string object = size.objectBytes > 0 ? std::to_string(size.objectBytes) : "-";
+        std::snprintf(line, sizeof(line), "  %-28s %10zu %8zu %8zu %8zu %8zu %10s\n", size.name.c_str(),
+                      size.stats.renderBytes, size.stats.elements, size.stats.handlers,
+                      size.stats.staticNodes, size.stats.staticBytes, object.c_str());
+        out << line;
+    }
+    return out.str();
+}
+
+void BuildTool::generateCssBundles(const std::vector<std::filesystem::path>& components) {
+    std::unordered_map<std::string, std::vector<std::string>> chunksByComponent;
+    for (const auto& [chunk, names] : config_.routeChunks) {
+        for (const auto& name : names) {
+            chunksByComponent[name].push_back(chunk);
+        }
+    }
+    
+    // Feuilles de chaque chunk, dans l'ordre des composants
+    std::map<std::string, std::vector<std::string>> stylesheets;
+    for (const auto& cvueFile : components) {
+        std::string css;
+        try {
+            css = readFile(cssOutputPath(cvueFile));
+        } catch (const std::exception&) {
+            continue;  // Composant en erreur
+        }
         
-        watchThread.join();
-    }).detach();
+        auto it = chunksByComponent.find(cvueFile.stem().string());
+        if (it == chunksByComponent.end()) {
+            stylesheets["main"].push_back(std::move(css));
+        } else {
+            for (const auto& chunk : it->second) {
+                stylesheets[chunk].push_back(css);
+            }
+        }
+    }
+    
+    auto cssDir = config_.buildDir / "css";
+    std::filesystem::create_directories(cssDir);
+    for (const auto& [chunk, sheets] : stylesheets) {
+        writeFileIfChanged(cssDir / (chunk + ".css"), CssProcessor::bundle(sheets, config_.minifyCss));
+    }
+    
+    // Bundles des chunks qui n'existent plus
+    std::error_code ec;
+    for (std::filesystem::directory_iterator it(cssDir, ec), end; !ec && it != end; it.increment(ec)) {
+        if (it->path().extension() == ".css" && stylesheets.count(it->path().stem().string()) == 0) {
+            std::error_code ignored;
+            std::filesystem::remove(it->path(), ignored);
+        }
+    }
 }
 
 std::string BuildTool::generateComponentId(const std::filesystem::path& cvueFile) {
-    return std::to_string(std::hash<std::string>{}(cvueFile.string()));
+    // Court (attribut data-v-<id> répété dans le CSS et le DOM) et stable d'une machine à l'autre
+    char id[9];
+    std::snprintf(id, sizeof(id), "%08x", static_cast<unsigned>(BuildCache::hashBytes(cacheKey(cvueFile))));
+    return id;
+}
+
+std::filesystem::path BuildTool::outputPath(const std::filesystem::path& cvueFile) const {
+    return config_.buildDir / cvueFile.filename().replace_extension(".cpp");
+}
+
+std::filesystem::path BuildTool::cssOutputPath(const std::filesystem::path& cvueFile) const {
+    return config_.buildDir / cvueFile.filename().replace_extension(".css");
+}
+
+std::string BuildTool::cmakePath(const std::filesystem::path& generatedFile) const {
+    return "${CMAKE_CURRENT_SOURCE_DIR}/" + generatedFile.lexically_relative(config_.buildDir).generic_string();
+}
+
+std::string BuildTool::componentIdentifier(const std::filesystem::path& cvueFile) {
+    std::string name = cvueFile.stem().string();
+    for (char& c : name) {
+        if (!std::isalnum(static_cast<unsigned char>(c))) {
+            c = '_';
+        }
+    }
+    if (!name.empty() && std::isdigit(static_cast<unsigned char>(name[0]))) {
+        name.insert(0, "_");
+    }
+    return name;
+}
+
+std::string BuildTool::factoryName(const std::filesystem::path& cvueFile) {
+    return "create" + componentIdentifier(cvueFile);
 }
 
 std::vector<std::filesystem::path> BuildTool::findCvueFiles() {
@@ -255,6 +857,9 @@ std::vector<std::filesystem::path> BuildTool::findCvueFiles() {
             result.push_back(entry.path());
         }
     }
+    
+    // L'ordre du système de fichiers n'est pas stable
+    std::sort(result.begin(), result.end());
     return result;
 }
 
@@ -265,66 +870,250 @@ void BuildTool::ensureDirectories() {
     std::filesystem::create_directories(config_.outputDir);
 }
 
-void BuildTool::analyzeDependencies() {
-    for (const auto& cvueFile : findCvueFiles()) {
-        std::ifstream file(cvueFile);
-        std::string content((std::istreambuf_iterator<char>(file)),
-                          std::istreambuf_iterator<char>());
-        
-        // Parse les imports et les composants utilisés
-        std::regex importRegex("#include\\s+[\"<]([^>\"]+)[\">]");
-        std::regex componentRegex("<([A-Z][\\w-]*)");
-        
-        std::smatch matches;
-        std::string::const_iterator searchStart(content.cbegin());
-        
-        ComponentDependency& dep = dependencies_[cvueFile.string()];
-        dep.path = cvueFile;
-        dep.lastModified = std::filesystem::last_write_time(cvueFile).time_since_epoch().count();
-        
-        while (std::regex_search(searchStart, content.cend(), matches, importRegex)) {
-            dep.dependencies.push_back(matches[1].str());
-            searchStart = matches.suffix().first;
-        }
-        
-        searchStart = content.cbegin();
-        while (std::regex_search(searchStart, content.cend(), matches, componentRegex)) {
-            dep.dependencies.push_back(matches[1].str());
-            searchStart = matches.suffix().first;
+void BuildTool::analyzeDependencies(const std::vector<std::filesystem::path>& components) {
+    std::vector<std::filesystem::path> includeDirs{config_.sourceDir};
+    includeDirs.insert(includeDirs.end(), config_.includes.begin(), config_.includes.end());
+    graph_.build(components, includeDirs);
+    checkDependencyCycles();
+    checkChunkDependencies(components);
+}
+
+void BuildTool::checkDependencyCycles() const {
+    auto cycle = graph_.findCycle();
+    if (cycle.empty()) {
+        return;
+    }
+    
+    std::string chain;
+    for (const auto& file : cycle) {
+        chain += (chain.empty() ? "" : " -> ") + file.lexically_relative(config_.sourceDir).generic_string();
+    }
+    throw BuildError("Dependency cycle between components: " + chain);
+}
+
+void BuildTool::checkChunkDependencies(const std::vector<std::filesystem::path>& components) const {
+    if (lazyChunks_.empty()) {
+        return;
+    }
+    for (const auto& component : components) {
+        auto chunk = lazyChunkOf(component);
+        for (const auto& dependency : graph_.dependencies(component)) {
+            if (dependency.extension() != ".cvue") {
+                continue;
+            }
+            auto dependencyChunk = lazyChunkOf(dependency);
+            if (!dependencyChunk.empty() && dependencyChunk != chunk) {
+                throw BuildError("Component " + component.stem().string() + " uses " +
+                                 dependency.stem().string() + " from lazily loaded chunk " + dependencyChunk +
+                                 " (reach it through a lazy route, or keep it in the main bundle)");
+            }
         }
     }
 }
 
-bool BuildTool::needsRecompilation(const std::filesystem::path& cvueFile) {
-    auto it = dependencies_.find(cvueFile.string());
-    if (it == dependencies_.end()) {
+std::string BuildTool::lazyChunkOf(const std::filesystem::path& cvueFile) const {
+    auto it = lazyChunks_.find(cvueFile.stem().string());
+    return it != lazyChunks_.end() ? it->second : std::string();
+}
+
+bool BuildTool::needsRecompilation(const std::filesystem::path& cvueFile, std::uint64_t sourceHash) {
+    if (!std::filesystem::exists(outputPath(cvueFile))) {
         return true;
     }
     
-    auto currentTime = std::filesystem::last_write_time(cvueFile).time_since_epoch().count();
-    if (currentTime > it->second.lastModified) {
-        return true;
+    // Le contenu fait foi, pas la date de modification (git checkout, touch...)
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    return !cache_.isFresh(cacheKey(cvueFile), sourceHash, optionsHash_);
+}
+
+void BuildTool::updateDependencyInfo(const std::filesystem::path& cvueFile, std::uint64_t sourceHash) {
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    cache_.record(cacheKey(cvueFile), sourceHash, optionsHash_);
+}
+
+std::string BuildTool::cacheKey(const std::filesystem::path& cvueFile) const {
+    return cvueFile.lexically_relative(config_.sourceDir).generic_string();
+}
+
+std::uint64_t BuildTool::computeOptionsHash() const {
+    // Tout ce qui change le code généré : version du compilateur et options
+    std::string options = COMPILER_VERSION;
+    options += '\0' + config_.projectName;
+    options += '\0' + std::string(config_.minifyCss ? "minify" : "");
+    options += '\0' + std::string(config_.compactCode ? "compact" : "");
+    
+    // Les composants des chunks chargés à la demande ont une autre fabrique
+    std::map<std::string, std::string> lazy(lazyChunks_.begin(), lazyChunks_.end());
+    for (const auto& [component, chunk] : lazy) {
+        options += '\0' + component + '=' + chunk;
+    }
+    return BuildCache::hashBytes(options);
+}
+
+void BuildTool::collectStaleOutputs(const std::vector<std::filesystem::path>& components) {
+    std::unordered_set<std::string> liveKeys;
+    std::unordered_set<std::string> liveOutputs;
+    for (const auto& cvueFile : components) {
+        liveKeys.insert(cacheKey(cvueFile));
+        liveOutputs.insert(outputPath(cvueFile).string());
+    }
+    
+    std::vector<std::string> removed;
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        removed = cache_.collectGarbage(liveKeys);
     }
     
-    // Vérifie les dépendances
-    for (const auto& dep : it->second.dependencies) {
-        auto depIt = dependencies_.find(dep);
-        if (depIt != dependencies_.end() && 
-            depIt->second.lastModified > it->second.lastModified) {
-            return true;
+    {
+        std::lock_guard<std::mutex> lock(generatedMutex_);
+        for (const auto& key : removed) {
+            generated_.erase(key);
         }
     }
     
-    return false;
+    for (const auto& key : removed) {
+        auto cppPath = outputPath(config_.sourceDir / key);
+        if (liveOutputs.count(cppPath.string()) > 0) {
+            continue;  // Même nom de sortie qu'un composant encore présent
+        }
+        std::error_code ignored;
+        std::filesystem::remove(cppPath, ignored);
+        std::filesystem::remove(cssOutputPath(config_.sourceDir / key), ignored);
+    }
 }
 
-void BuildTool::updateDependencyInfo(const std::filesystem::path& cvueFile) {
-    auto& dep = dependencies_[cvueFile.string()];
-    dep.lastModified = std::filesystem::last_write_time(cvueFile).time_since_epoch().count();
+void BuildTool::setupHotReload() {
+    // État de départ : le premier changement de template est déjà un rendu seul
+    for (const auto& cvueFile : findCvueFiles()) {
+        hotReloadMessage(cvueFile, false);
+    }
+    
+    hotServer_ = std::make_unique<HotReloadServer>(config_.hotReloadPort, config_.buildDir);
+    try {
+        hotServer_->start();
+    } catch (const std::exception& e) {
+        hotServer_.reset();
+        throw BuildError("Failed to start hot reload server: " + std::string(e.what()));
+    }
+    std::cerr << "Hot reload on http://127.0.0.1:" << hotServer_->port()
+              << " (page script: /cppvue-hot.js)" << std::endl;
+}
+
+void BuildTool::notifyHotReload(const std::vector<std::filesystem::path>& rebuilt, bool dependencyChanged) {
+    std::vector<std::string> messages;
+    bool fullReload = false;
+    for (const auto& file : rebuilt) {
+        std::string message = hotReloadMessage(file, dependencyChanged);
+        if (message.rfind("{\"type\":\"reload\"", 0) == 0) {
+            fullReload = true;
+        } else if (!message.empty()) {
+            messages.push_back(std::move(message));
+        }
+    }
+    
+    if (!hotServer_) {
+        return;
+    }
+    if (fullReload) {
+        hotServer_->broadcast("{\"type\":\"reload\"}");
+        return;
+    }
+    for (const auto& message : messages) {
+        hotServer_->broadcast(message);
+    }
 }
 
-void BuildTool::notifyHotReload(const std::filesystem::path& component) {
-    // TODO: Implémenter la notification WebSocket pour le hot reload
+namespace {
+    std::string jsonString(const std::string& value) {
+        std::string result = "\"";
+        for (char c : value) {
+            switch (c) {
+                case '"': result += "\\\""; break;
+                case '\\': result += "\\\\"; break;
+                case '\n': result += "\\n"; break;
+                case '\r': result += "\\r"; break;
+                case '\t': result += "\\t"; break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20) {
+                        char escaped[7];
+                        std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                        result += escaped;
+                    } else {
+                        result += c;
+                    }
+            }
+        }
+        return result + "\"";
+    }
+}
+
+std::string BuildTool::hotReloadMessage(const std::filesystem::path& component, bool dependencyChanged) {
+    CvueFileContent content;
+    try {
+        content = CvueCompiler::parseCvueFile(readFile(component));
+    } catch (const std::exception&) {
+        return {};
+    }
+    HotReloadHashes hashes{CvueCompiler::scriptHash(content),
+                           BuildCache::hashBytes(content.template_content),
+                           BuildCache::hashBytes(content.style_content)};
+    
+    auto it = hotHashes_.find(cacheKey(component));
+    bool known = it != hotHashes_.end();
+    HotReloadHashes previous = known ? it->second : HotReloadHashes{};
+    hotHashes_[cacheKey(component)] = hashes;
+    
+    bool scriptChanged = !known || previous.script != hashes.script;
+    bool templateChanged = previous.templ != hashes.templ;
+    bool styleChanged = previous.style != hashes.style;
+    if (dependencyChanged || scriptChanged) {
+        return "{\"type\":\"reload\"}";
+    }
+    if (!templateChanged && !styleChanged) {
+        return {};  // Recompilé pour un composant enfant, qui a son propre message
+    }
+    
+    std::string className = component.stem().string();
+    std::string css;
+    try {
+        css = readFile(cssOutputPath(component));
+    } catch (const std::exception&) {
+        // Composant sans style généré
+    }
+    
+    std::string message;
+    if (!templateChanged) {
+        message = "{\"type\":\"style\"";
+    } else if (buildHotModule(component)) {
+        message = "{\"type\":\"render\",\"module\":" + jsonString("/hot/" + className + ".wasm") +
+                  ",\"revision\":" + std::to_string(++hotRevision_);
+    } else {
+        return "{\"type\":\"reload\"}";
+    }
+    return message + ",\"component\":" + jsonString(className) + ",\"css\":" + jsonString(css) + "}";
+}
+
+bool BuildTool::buildHotModule(const std::filesystem::path& component) {
+    if (config_.hotModuleCommand.empty()) {
+        return false;
+    }
+    
+    std::string command = config_.hotModuleCommand;
+    std::string className = component.stem().string();
+    for (std::size_t pos; (pos = command.find("{name}")) != std::string::npos;) {
+        command.replace(pos, 6, className);
+    }
+    
+    auto module = config_.buildDir / "hot" / (className + ".wasm");
+    PhaseScope phase("hot-module", component);
+    std::error_code ec;
+    auto before = std::filesystem::last_write_time(module, ec);
+    if (std::system(command.c_str()) != 0) {
+        std::cerr << "Hot module build failed: " << command << std::endl;
+        return false;
+    }
+    auto after = std::filesystem::last_write_time(module, ec);
+    return !ec && after != before;
 }
 
 } // namespace cppvue::compiler
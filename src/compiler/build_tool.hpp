@@ -1,6 +1,15 @@
 #pragma once
 
+#include "build_cache.hpp"
+#include "dependency_graph.hpp"
+#include "file_watcher.hpp"
+#include "hot_reload_server.hpp"
+#include <cstdint>
 #include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -13,54 +22,165 @@ struct BuildConfig {
     std::filesystem::path buildDir;       // Répertoire de build pour les fichiers temporaires
     std::string projectName;              // Nom du projet
     bool enableHotReload = false;         // Activer le rechargement à chaud
+    std::uint16_t hotReloadPort = 35729;  // Port du serveur de hot reload (watch), 0 = libre
+    
+    // Commande produisant buildDir/hot/<Composant>.wasm après un changement de
+    // template ({name} = nom de classe) ; vide : rechargement complet de la page
+    std::string hotModuleCommand;
     bool minifyCss = false;              // Minifier le CSS généré
     std::vector<std::string> includes;    // Chemins d'inclusion supplémentaires
+    unsigned jobs = 0;                    // Compilations parallèles (-j), 0 = un par cœur
+    bool keepGeneratedCode = false;       // Code généré gardé en mémoire (watch, daemon)
+    bool precompiledHeaders = false;      // En-tête précompilé (CppVue et std) pour les composants
+    bool timeTrace = false;               // -ftime-trace (Clang) sur les sources générées
+    bool compactCode = false;             // Structure statique des templates en blobs partagés
+    
+    // Composants par unité de compilation unity (voisins dans le graphe de
+    // dépendances regroupés) ; 0 : une unité par composant
+    std::size_t unityBatchSize = 0;
+    
+    // Chunks de route : nom -> composants (noms de classe) dont le CSS est
+    // regroupé dans css/<nom>.css ; les autres composants vont dans css/main.css
+    std::map<std::string, std::vector<std::string>> routeChunks;
+    
+    // Chunks compilés en modules chargés à la demande (chunks/<nom>.wasm ou .so)
+    // hors de la bibliothèque principale ; un composant listé dans plusieurs
+    // chunks reste dans la bibliothèque principale
+    bool lazyChunks = false;
+};
+
+// Résultat d'une passe incrémentale
+struct BuildReport {
+    std::vector<std::filesystem::path> compiled;  // Composants régénérés, enfants d'abord
+    std::vector<std::string> errors;              // Un message par composant en erreur
+    std::size_t checked = 0;                      // Composants dont le hash a été comparé
 };
 
 class BuildTool {
 public:
     explicit BuildTool(BuildConfig config);
+    ~BuildTool();
     
     // Génère les fichiers de build
     bool generateBuildFiles();
     
-    // Compile tous les fichiers .cvue
+    // Compile tous les fichiers .cvue en parallèle (config.jobs threads).
+    // Les erreurs de tous les composants sont regroupées dans une seule BuildError.
     bool buildComponents();
     
-    // Surveille les changements et recompile automatiquement
+    // Recompile les composants touchés par ces fichiers (modifiés, ajoutés ou
+    // supprimés) ; les erreurs sont rapportées, pas levées
+    BuildReport compileChanged(const std::vector<std::filesystem::path>& changed);
+    
+    // Contribution de chaque composant au code généré (source de render(),
+    // handlers, blobs statiques partagés, objet compilé s'il existe sous buildDir)
+    std::string codeSizeReport();
+    
+    // Surveille les changements et recompile automatiquement, sur un thread
+    // dédié (inotify sous Linux, scrutation sinon) jusqu'à stopWatching()
     void watchAndRebuild();
+    void stopWatching();
     
 private:
     // Génération des fichiers CMake
     void generateCMakeLists();
-    void generateComponentRegistry();
+    // component_registry.hpp : table constexpr nom -> identifiant -> fabrique
+    // (hachage parfait calculé ici), réécrite si l'ensemble des composants change
+    void generateComponentRegistry(const std::vector<std::filesystem::path>& components);
+    
+    // Unités unity (buildDir/unity/unity_N.cpp) et en-tête précompilé ;
+    // fichiers réécrits seulement si leur contenu change
+    std::vector<std::filesystem::path> generateUnitySources(const std::vector<std::filesystem::path>& components);
+    std::vector<std::vector<std::filesystem::path>> unityBatches(const std::vector<std::filesystem::path>& components);
+    std::filesystem::path generatePrecompiledHeader();
     
-    // Compilation des composants
+    // Compilation des composants (appelée depuis les workers : seul generated_
+    // est partagé, sous generatedMutex_)
     bool compileSingleComponent(const std::filesystem::path& cvueFile);
     void generateComponentLoader(const std::vector<std::filesystem::path>& components);
     
-    // Gestion des dépendances
-    struct ComponentDependency {
-        std::filesystem::path path;
-        std::time_t lastModified;
-        std::vector<std::string> dependencies;
-    };
+    // Un bundle CSS par chunk de route, règles dupliquées retirées
+    void generateCssBundles(const std::vector<std::filesystem::path>& components);
+    
+    // Recompile une rafale de fichiers signalée par le watcher
+    void rebuildChanged(const std::vector<std::filesystem::path>& changed);
+    
+    // Reconstruit le graphe de dépendances ; BuildError si des composants
+    // dépendent les uns des autres en boucle
+    void analyzeDependencies(const std::vector<std::filesystem::path>& components);
+    void checkDependencyCycles() const;
     
-    void analyzeDependencies();
-    bool needsRecompilation(const std::filesystem::path& cvueFile);
-    void updateDependencyInfo(const std::filesystem::path& cvueFile);
+    // BuildError si l'un de ces composants utilise un composant d'un autre
+    // chunk chargé à la demande (absent de son module et du programme)
+    void checkChunkDependencies(const std::vector<std::filesystem::path>& components) const;
     
-    // Hot Reload
+    // Chunk chargé à la demande contenant ce composant, vide sinon
+    std::string lazyChunkOf(const std::filesystem::path& cvueFile) const;
+    
+    // Sortie absente, ou hash (source et dépendances) / options différent de la
+    // dernière compilation réussie
+    bool needsRecompilation(const std::filesystem::path& cvueFile, std::uint64_t sourceHash);
+    void updateDependencyInfo(const std::filesystem::path& cvueFile, std::uint64_t sourceHash);
+    
+    // Clé de cache : chemin relatif au répertoire source
+    std::string cacheKey(const std::filesystem::path& cvueFile) const;
+    std::uint64_t computeOptionsHash() const;
+    
+    // Supprime les entrées et les fichiers générés des composants disparus
+    void collectStaleOutputs(const std::vector<std::filesystem::path>& components);
+    
+    // Hot Reload : serveur démarré par watchAndRebuild, puis un message par
+    // rafale (style seul, rendu seul via un module, ou rechargement complet)
     void setupHotReload();
-    void notifyHotReload(const std::filesystem::path& component);
+    void notifyHotReload(const std::vector<std::filesystem::path>& rebuilt, bool dependencyChanged);
+    std::string hotReloadMessage(const std::filesystem::path& component, bool dependencyChanged);
+    bool buildHotModule(const std::filesystem::path& component);
     
     // Helpers
     std::string generateComponentId(const std::filesystem::path& cvueFile);
+    static std::string componentIdentifier(const std::filesystem::path& cvueFile);  // Nom utilisable en C++
+    static std::string factoryName(const std::filesystem::path& cvueFile);
+    std::filesystem::path outputPath(const std::filesystem::path& cvueFile) const;
+    std::filesystem::path cssOutputPath(const std::filesystem::path& cvueFile) const;
+    // Chemin d'un fichier généré dans le CMakeLists de buildDir, indépendant du
+    // répertoire d'où cvuec est lancé (buildDir peut être relatif)
+    std::string cmakePath(const std::filesystem::path& generatedFile) const;
     std::vector<std::filesystem::path> findCvueFiles();
     void ensureDirectories();
     
     BuildConfig config_;
-    std::unordered_map<std::string, ComponentDependency> dependencies_;
+    DependencyGraph graph_;
+    std::unordered_map<std::string, std::string> lazyChunks_;  // Composant -> chunk (lazyChunks)
+    
+    // Une seule passe de build à la fois (build initial ou rafale du watcher)
+    std::mutex buildMutex_;
+    
+    // Cache persistant (buildDir/.cvue-cache)
+    BuildCache cache_;
+    std::uint64_t optionsHash_;
+    std::mutex cacheMutex_;
+    
+    std::unique_ptr<FileWatcher> watcher_;
+    
+    // Dernières versions générées par composant (keepGeneratedCode), par hash du source
+    struct GeneratedCode {
+        std::uint64_t sourceHash;
+        std::string cpp;
+        std::string css;
+    };
+    static constexpr std::size_t GENERATED_VERSIONS = 4;
+    std::unordered_map<std::string, std::vector<GeneratedCode>> generated_;
+    std::mutex generatedMutex_;
+    
+    // Hashes des sections de chaque composant au dernier message envoyé
+    struct HotReloadHashes {
+        std::uint64_t script = 0;
+        std::uint64_t templ = 0;
+        std::uint64_t style = 0;
+    };
+    std::unordered_map<std::string, HotReloadHashes> hotHashes_;
+    std::unique_ptr<HotReloadServer> hotServer_;
+    std::size_t hotRevision_ = 0;
 };
 
 // Classe pour la gestion des erreurs de build
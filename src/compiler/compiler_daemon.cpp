@@ -0,0 +1,363 @@
+#include "compiler_daemon.hpp"
+#include "cvue_compiler.hpp"
+#include "file_io.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace cppvue::compiler {
+
+namespace {
+    constexpr std::size_t MAX_LINE_SIZE = 64 * 1024;
+    constexpr std::size_t MAX_PAYLOAD_SIZE = 16 * 1024 * 1024;
+
+    // Chemins absolus : ceux des requêtes se comparent aux nœuds du graphe
+    BuildConfig daemonConfig(BuildConfig config) {
+        config.keepGeneratedCode = true;
+        config.sourceDir = std::filesystem::absolute(config.sourceDir).lexically_normal();
+        config.buildDir = std::filesystem::absolute(config.buildDir).lexically_normal();
+        config.outputDir = std::filesystem::absolute(config.outputDir).lexically_normal();
+        return config;
+    }
+
+    bool sendAll(int fd, const std::string& data) {
+        std::size_t sent = 0;
+        while (sent < data.size()) {
+            ssize_t n = ::send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            if (n <= 0) {
+                return false;
+            }
+            sent += static_cast<std::size_t>(n);
+        }
+        return true;
+    }
+
+    // Une ligne "error" par ligne du message
+    std::string errorLines(const std::string& message) {
+        std::string result;
+        std::size_t start = 0;
+        while (start < message.size()) {
+            auto end = std::min(message.find('\n', start), message.size());
+            auto line = message.substr(start, end - start);
+            if (line.find_first_not_of(" \t") != std::string::npos) {
+                result += "error " + line + "\n";
+            }
+            start = end + 1;
+        }
+        return result.empty() ? "error unknown error\n" : result;
+    }
+
+    bool fillAddress(sockaddr_un& address, const std::filesystem::path& socketPath) {
+        std::string path = socketPath.string();
+        if (path.empty() || path.size() >= sizeof(address.sun_path)) {
+            return false;
+        }
+        address = {};
+        address.sun_family = AF_UNIX;
+        std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+        return true;
+    }
+
+    // Descripteur connecté au daemon, -1 si personne n'écoute
+    int connectTo(const std::filesystem::path& socketPath) {
+        sockaddr_un address;
+        if (!fillAddress(address, socketPath)) {
+            return -1;
+        }
+        int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (fd >= 0 && ::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+            ::close(fd);
+            return -1;
+        }
+        return fd;
+    }
+
+    std::string milliseconds(std::chrono::steady_clock::time_point start) {
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count());
+    }
+}
+
+CompilerDaemon::CompilerDaemon(std::filesystem::path socketPath, BuildConfig config)
+    : socketPath_(std::move(socketPath)),
+      config_(daemonConfig(std::move(config))),
+      tool_(config_) {
+    // Les sources peuvent être réécrites pendant une lecture : pas de projection
+    MappedFile::setMappingEnabled(false);
+}
+
+CompilerDaemon::~CompilerDaemon() {
+    stop();
+}
+
+void CompilerDaemon::start() {
+    if (running_) {
+        return;
+    }
+
+    // Un daemon vivant garde sa socket ; celle d'un daemon arrêté brutalement est remplacée
+    if (int fd = connectTo(socketPath_); fd >= 0) {
+        ::close(fd);
+        throw std::runtime_error("Compiler daemon already running on " + socketPath_.string());
+    }
+    std::error_code ignored;
+    std::filesystem::remove(socketPath_, ignored);
+
+    sockaddr_un address;
+    if (!fillAddress(address, socketPath_)) {
+        throw std::runtime_error("Compiler daemon: invalid socket path " + socketPath_.string());
+    }
+    listenFd_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (listenFd_ < 0 ||
+        ::bind(listenFd_, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        ::chmod(address.sun_path, S_IRUSR | S_IWUSR) != 0 ||
+        ::listen(listenFd_, 16) != 0 || ::pipe2(wakePipe_, O_NONBLOCK | O_CLOEXEC) != 0) {
+        std::string error = std::strerror(errno);
+        stop();
+        throw std::runtime_error("Compiler daemon: cannot listen on " + socketPath_.string() + ": " + error);
+    }
+
+    running_ = true;
+    thread_ = std::thread(&CompilerDaemon::run, this);
+}
+
+void CompilerDaemon::stop() {
+    if (running_.exchange(false) && wakePipe_[1] >= 0) {
+        char byte = 0;
+        [[maybe_unused]] auto written = ::write(wakePipe_[1], &byte, 1);
+    }
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+
+    for (auto& connection : connections_) {
+        ::close(connection.fd);
+    }
+    connections_.clear();
+    if (listenFd_ >= 0) {
+        std::error_code ignored;
+        std::filesystem::remove(socketPath_, ignored);
+    }
+    for (int* fd : {&listenFd_, &wakePipe_[0], &wakePipe_[1]}) {
+        if (*fd >= 0) {
+            ::close(*fd);
+            *fd = -1;
+        }
+    }
+}
+
+void CompilerDaemon::run() {
+    std::vector<pollfd> fds;
+    while (running_) {
+        fds.clear();
+        fds.push_back({wakePipe_[0], POLLIN, 0});
+        fds.push_back({listenFd_, POLLIN, 0});
+        for (const auto& connection : connections_) {
+            fds.push_back({connection.fd, POLLIN, 0});
+        }
+
+        if (::poll(fds.data(), fds.size(), -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        if (fds[0].revents) {
+            break;
+        }
+
+        // Requêtes traitées une à une : les compilations ne se chevauchent pas
+        std::size_t polled = connections_.size();
+        for (std::size_t i = 0; i < polled && running_; ++i) {
+            if (fds[i + 2].revents && !serve(connections_[i])) {
+                ::close(connections_[i].fd);
+                connections_[i].fd = -1;
+            }
+        }
+        connections_.erase(std::remove_if(connections_.begin(), connections_.end(),
+                                          [](const Connection& c) { return c.fd < 0; }),
+                           connections_.end());
+
+        if (fds[1].revents & POLLIN) {
+            int fd = ::accept4(listenFd_, nullptr, nullptr, SOCK_CLOEXEC);
+            if (fd >= 0) {
+                connections_.push_back({fd, {}});
+            }
+        }
+    }
+}
+
+bool CompilerDaemon::serve(Connection& connection) {
+    char chunk[64 * 1024];
+    ssize_t n = ::recv(connection.fd, chunk, sizeof(chunk), 0);
+    if (n <= 0) {
+        return false;
+    }
+    connection.buffer.append(chunk, static_cast<std::size_t>(n));
+
+    for (;;) {
+        auto lineEnd = connection.buffer.find('\n');
+        if (lineEnd == std::string::npos) {
+            return connection.buffer.size() <= MAX_LINE_SIZE;
+        }
+        std::string request = connection.buffer.substr(0, lineEnd);
+        std::size_t consumed = lineEnd + 1;
+
+        // check NOM TAILLE : le source suit la ligne
+        std::string payload;
+        if (request.rfind("check ", 0) == 0) {
+            std::size_t size = std::strtoull(request.c_str() + request.rfind(' ') + 1, nullptr, 10);
+            if (size > MAX_PAYLOAD_SIZE) {
+                sendAll(connection.fd, "error source too large\nend\n");
+                return false;
+            }
+            if (connection.buffer.size() < consumed + size) {
+                return true;  // Attend la suite du source
+            }
+            payload = connection.buffer.substr(consumed, size);
+            consumed += size;
+        }
+        connection.buffer.erase(0, consumed);
+
+        if (!sendAll(connection.fd, handle(request, payload) + "end\n") || !running_) {
+            return false;
+        }
+    }
+}
+
+std::string CompilerDaemon::handle(const std::string& request, const std::string& payload) {
+    ++requests_;
+    auto space = request.find(' ');
+    std::string command = request.substr(0, space);
+    std::string arguments = space == std::string::npos ? "" : request.substr(space + 1);
+
+    if (command == "compile") {
+        return compile(arguments);
+    }
+    if (command == "check") {
+        auto nameEnd = arguments.rfind(' ');
+        if (nameEnd == 0 || nameEnd == std::string::npos) {
+            return "error usage: check NAME SIZE\n";
+        }
+        return check(arguments.substr(0, nameEnd), payload);
+    }
+    if (command == "stats") {
+        return "requests " + std::to_string(requests_) + "\nchecks " + std::to_string(checkCount_) + " " +
+               std::to_string(checkHits_) + "\n";
+    }
+    if (command == "shutdown") {
+        running_ = false;
+        return "";
+    }
+    return "error unknown request " + command + "\n";
+}
+
+std::string CompilerDaemon::compile(const std::string& arguments) {
+    auto start = std::chrono::steady_clock::now();
+
+    // Passe complète : fichiers ajoutés, en-têtes modifiés hors watcher...
+    if (arguments.empty()) {
+        std::string errors;
+        try {
+            tool_.buildComponents();
+        } catch (const std::exception& e) {
+            errors = errorLines(e.what());
+        }
+        return "built " + milliseconds(start) + "\n" + errors;
+    }
+
+    std::vector<std::filesystem::path> files;
+    std::size_t begin = 0;
+    while (begin <= arguments.size()) {
+        auto end = std::min(arguments.find('\t', begin), arguments.size());
+        if (end > begin) {
+            std::filesystem::path file = arguments.substr(begin, end - begin);
+            files.push_back((file.is_absolute() ? file : config_.sourceDir / file).lexically_normal());
+        }
+        begin = end + 1;
+    }
+
+    auto report = tool_.compileChanged(files);
+    std::string response = "compiled " + std::to_string(report.compiled.size()) + " " + milliseconds(start) + "\n";
+    for (const auto& file : report.compiled) {
+        response += "file " + file.lexically_relative(config_.sourceDir).generic_string() + "\n";
+    }
+    for (const auto& error : report.errors) {
+        response += errorLines(error);
+    }
+    return response;
+}
+
+std::string CompilerDaemon::check(const std::string& name, const std::string& source) {
+    ++checkCount_;
+    std::uint64_t key = BuildCache::hashBytes(name + '\0' + source);
+    if (auto it = checks_.find(key); it != checks_.end()) {
+        ++checkHits_;
+        return it->second;
+    }
+
+    std::string response = "ok\n";
+    try {
+        auto content = CvueCompiler::parseCvueFile(source);
+        CvueCompiler::generateCppCode(content, name, name);
+        CvueCompiler::generateCssCode(content, name);
+    } catch (const std::exception& e) {
+        response = errorLines(e.what());
+    }
+
+    if (checkOrder_.size() == CHECK_CACHE_SIZE) {
+        checks_.erase(checkOrder_.front());
+        checkOrder_.pop_front();
+    }
+    checkOrder_.push_back(key);
+    checks_.emplace(key, response);
+    return response;
+}
+
+std::string CompilerDaemonClient::request(const std::filesystem::path& socketPath, const std::string& request,
+                                          const std::string& payload) {
+    int fd = connectTo(socketPath);
+    if (fd < 0) {
+        throw std::runtime_error("No compiler daemon on " + socketPath.string());
+    }
+
+    std::string response;
+    bool complete = false;
+    if (sendAll(fd, request + "\n" + payload)) {
+        char chunk[64 * 1024];
+        while (!complete) {
+            ssize_t n = ::recv(fd, chunk, sizeof(chunk), 0);
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            if (n <= 0) {
+                break;
+            }
+            response.append(chunk, static_cast<std::size_t>(n));
+            complete = response == "end\n" ||
+                       (response.size() > 4 && response.compare(response.size() - 5, 5, "\nend\n") == 0);
+        }
+    }
+    ::close(fd);
+
+    if (!complete) {
+        throw std::runtime_error("Compiler daemon on " + socketPath.string() + " closed the connection");
+    }
+    response.resize(response.size() - 4);
+    return response;
+}
+
+} // namespace cppvue::compiler
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "build_tool.hpp"
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace cppvue::compiler {
+
+// Service de compilation persistant sur une socket Unix (cvuec --daemon).
+// Le BuildTool reste chargé entre les requêtes : graphe de dépendances, cache
+// et code généré en mémoire ; une requête ne relit que les fichiers signalés.
+//
+// Protocole texte, une requête par ligne, chaque réponse terminée par "end" :
+//   compile [FICHIER\tFICHIER...]   composants touchés par ces fichiers
+//                                   -> "compiled N MS", "file F"..., "error MSG"...
+//   compile                         passe complète -> "built MS", "error MSG"...
+//   check NOM TAILLE\n<octets>      source non enregistré (éditeur), rien n'est
+//                                   écrit -> "ok" ou "error MSG"...
+//   stats                           -> "requests N", "checks N CACHÉS"
+//   shutdown
+// Les chemins relatifs partent du répertoire source.
+class CompilerDaemon {
+public:
+    CompilerDaemon(std::filesystem::path socketPath, BuildConfig config);
+    ~CompilerDaemon();
+
+    CompilerDaemon(const CompilerDaemon&) = delete;
+    CompilerDaemon& operator=(const CompilerDaemon&) = delete;
+
+    // Ouvre la socket (droits 0600) puis démarre le thread du service ;
+    // std::runtime_error si un autre daemon y répond déjà
+    void start();
+    void stop();
+
+    // Faux après stop() ou une requête shutdown
+    bool running() const { return running_; }
+
+    // Outil de build partagé, par exemple avec watchAndRebuild()
+    BuildTool& buildTool() { return tool_; }
+
+private:
+    struct Connection {
+        int fd = -1;
+        std::string buffer;
+    };
+
+    void run();
+
+    // Traite les requêtes complètes du tampon ; false quand la connexion doit être fermée
+    bool serve(Connection& connection);
+
+    // Réponse à une requête, sans le "end" final
+    std::string handle(const std::string& request, const std::string& payload);
+
+    std::string compile(const std::string& arguments);
+    std::string check(const std::string& name, const std::string& source);
+
+    std::filesystem::path socketPath_;
+    BuildConfig config_;
+    BuildTool tool_;
+
+    int listenFd_ = -1;
+    int wakePipe_[2] = {-1, -1};
+    std::thread thread_;
+    std::atomic<bool> running_{false};
+    std::vector<Connection> connections_;
+
+    // Réponses de check par hash (nom, source) : un éditeur renvoie souvent
+    // le même contenu (focus, sauvegarde, annulation)
+    static constexpr std::size_t CHECK_CACHE_SIZE = 256;
+    std::unordered_map<std::uint64_t, std::string> checks_;
+    std::deque<std::uint64_t> checkOrder_;
+
+    std::size_t requests_ = 0;
+    std::size_t checkCount_ = 0;
+    std::size_t checkHits_ = 0;
+};
+
+// Client du daemon : envoie une requête et renvoie la réponse (sans "end") ;
+// std::runtime_error si aucun daemon n'écoute sur socketPath
+class CompilerDaemonClient {
+public:
+    static std::string request(const std::filesystem::path& socketPath, const std::string& request,
+                               const std::string& payload = "");
+};
+
+} // namespace cppvue::compiler
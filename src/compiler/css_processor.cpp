@@ -0,0 +1,448 @@
+#include "css_processor.hpp"
+#include "css_tokenizer.hpp"
+#include <algorithm>
+#include <cctype>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace cppvue::compiler {
+
+namespace {
+    using Type = CssToken::Type;
+
+    bool startsWith(std::string_view str, std::string_view prefix) {
+        return str.substr(0, prefix.size()) == prefix;
+    }
+
+    std::string_view trim(std::string_view str) {
+        while (!str.empty() && str.front() == ' ') str.remove_prefix(1);
+        while (!str.empty() && str.back() == ' ') str.remove_suffix(1);
+        return str;
+    }
+
+    // Parcourt str en ignorant chaînes, crochets et parenthèses : visit(i) est
+    // appelé pour chaque caractère de premier niveau, jusqu'à ce qu'il renvoie true
+    template<typename Visit>
+    std::size_t scanTopLevel(std::string_view str, Visit visit) {
+        int depth = 0;
+        for (std::size_t i = 0; i < str.size(); ++i) {
+            char c = str[i];
+            if (c == '"' || c == '\'') {
+                for (++i; i < str.size() && str[i] != c; ++i) {
+                    if (str[i] == '\\') ++i;
+                }
+            } else if (c == '\\') {
+                ++i;
+            } else if (c == '(' || c == '[') {
+                ++depth;
+            } else if (c == ')' || c == ']') {
+                depth = std::max(depth - 1, 0);
+            } else if (depth == 0 && visit(i)) {
+                return i;
+            }
+        }
+        return std::string_view::npos;
+    }
+
+    std::vector<std::string_view> splitTopLevel(std::string_view str, char separator) {
+        std::vector<std::string_view> parts;
+        std::size_t start = 0;
+        scanTopLevel(str, [&](std::size_t i) {
+            if (str[i] == separator) {
+                parts.push_back(trim(str.substr(start, i - start)));
+                start = i + 1;
+            }
+            return false;
+        });
+        parts.push_back(trim(str.substr(start)));
+        return parts;
+    }
+
+    // Supprime les espaces autour (before/after) des caractères donnés, hors chaînes
+    std::string compact(std::string_view str, std::string_view spaceBefore, std::string_view spaceAfter) {
+        std::string out;
+        out.reserve(str.size());
+        for (std::size_t i = 0; i < str.size(); ++i) {
+            char c = str[i];
+            if (c == '"' || c == '\'') {
+                std::size_t start = i;
+                for (++i; i < str.size() && str[i] != c; ++i) {
+                    if (str[i] == '\\') ++i;
+                }
+                out.append(str.substr(start, i - start + 1));
+                continue;
+            }
+            if (c == ' ') {
+                bool dropBefore = i + 1 < str.size() && spaceBefore.find(str[i + 1]) != std::string_view::npos;
+                bool dropAfter = !out.empty() && spaceAfter.find(out.back()) != std::string_view::npos;
+                if (dropBefore || dropAfter) {
+                    continue;
+                }
+            }
+            out += c;
+        }
+        return out;
+    }
+
+    // Nom d'une at-rule sans préfixe vendeur : "@-webkit-keyframes x" -> "keyframes"
+    std::string atRuleName(std::string_view prelude) {
+        std::size_t end = 1;
+        while (end < prelude.size() &&
+               (std::isalnum(static_cast<unsigned char>(prelude[end])) || prelude[end] == '-')) {
+            ++end;
+        }
+        std::string name(prelude.substr(1, end - 1));
+        std::transform(name.begin(), name.end(), name.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        if (startsWith(name, "-")) {
+            auto dash = name.find('-', 1);
+            name = dash == std::string::npos ? name : name.substr(dash + 1);
+        }
+        return name;
+    }
+
+    // At-rules dont le bloc contient des règles (ou, imbriquées dans une règle, des déclarations)
+    bool isGroupingRule(const std::string& name) {
+        static const std::unordered_set<std::string> names{
+            "media", "supports", "container", "layer", "scope", "document", "starting-style"};
+        return names.count(name) > 0;
+    }
+
+    // Contenu d'un bloc : règles (scopées ou non) ou déclarations
+    enum class BlockMode { ScopedRules, Rules, Declarations };
+
+    class StyleWriter {
+    public:
+        StyleWriter(std::string_view css, const CssOptions& options)
+            : tokenizer_(css), options_(options) {
+            advance();
+        }
+
+        std::string run() {
+            BlockMode mode = options_.scopeId.empty() ? BlockMode::Rules : BlockMode::ScopedRules;
+            while (token_.type != Type::END) {
+                writeBlockContents(0, mode);
+                if (token_.type == Type::CLOSE_BRACE) {
+                    advance();  // } orpheline
+                }
+            }
+            return std::move(out_);
+        }
+
+    private:
+        void advance() {
+            token_ = tokenizer_.next();
+        }
+
+        // Texte jusqu'au prochain { ; } : espaces réduits, commentaires retirés
+        std::string readText() {
+            std::string text;
+            bool space = false;
+            for (;; advance()) {
+                if (token_.type == Type::WHITESPACE || token_.type == Type::COMMENT) {
+                    space = !text.empty();
+                } else if (token_.type == Type::STRING || token_.type == Type::TEXT) {
+                    if (space) {
+                        text += ' ';
+                    }
+                    space = false;
+                    text += token_.value;
+                } else {
+                    return text;
+                }
+            }
+        }
+
+        // Espaces et commentaires entre deux éléments : les commentaires sont
+        // gardés en sortie lisible, seuls les /*! ... */ en sortie compacte
+        void skipSeparators(int depth) {
+            for (; token_.type == Type::WHITESPACE || token_.type == Type::COMMENT; advance()) {
+                if (token_.type == Type::COMMENT && (!options_.minify || startsWith(token_.value, "/*!"))) {
+                    indent(depth);
+                    out_ += token_.value;
+                    newline();
+                }
+            }
+        }
+
+        void writeBlockContents(int depth, BlockMode mode) {
+            for (;;) {
+                skipSeparators(depth);
+                if (token_.type == Type::END || token_.type == Type::CLOSE_BRACE) {
+                    return;
+                }
+                if (token_.type == Type::SEMICOLON) {
+                    advance();
+                    continue;
+                }
+
+                std::string text = readText();
+                if (token_.type == Type::OPEN_BRACE) {
+                    advance();
+                    writeNestedBlock(depth, mode, text);
+                    if (token_.type == Type::CLOSE_BRACE) {
+                        advance();
+                    }
+                } else if (!text.empty()) {
+                    if (token_.type == Type::SEMICOLON) {
+                        advance();
+                    }
+                    if (mode == BlockMode::Declarations && text[0] != '@') {
+                        writeDeclaration(depth, text);
+                    } else {
+                        // @import, @charset, @layer a, b; ...
+                        indent(depth);
+                        out_ += options_.minify ? compactAtPrelude(text) : text;
+                        out_ += ';';
+                        newline();
+                    }
+                }
+            }
+        }
+
+        void writeNestedBlock(int depth, BlockMode mode, const std::string& prelude) {
+            BlockMode inner;
+            std::string header;
+            if (!prelude.empty() && prelude[0] == '@') {
+                std::string name = atRuleName(prelude);
+                if (isGroupingRule(name)) {
+                    inner = mode;
+                } else if (name == "keyframes") {
+                    inner = BlockMode::Rules;  // from, to, 50% : jamais scopés
+                } else {
+                    inner = BlockMode::Declarations;  // @font-face, @page...
+                }
+                header = options_.minify ? compactAtPrelude(prelude) : prelude;
+            } else {
+                inner = BlockMode::Declarations;
+                header = mode == BlockMode::ScopedRules
+                    ? CssProcessor::scopeSelector(prelude, options_.scopeId)
+                    : prelude;
+                if (options_.minify) {
+                    header = compact(header, ">+~,", ">+~,");
+                }
+            }
+
+            // Un bloc vide est retiré de la sortie
+            std::size_t mark = out_.size();
+            indent(depth);
+            out_ += header;
+            out_ += options_.minify ? "{" : " {";
+            newline();
+            std::size_t bodyStart = out_.size();
+
+            writeBlockContents(depth + 1, inner);
+
+            if (out_.size() == bodyStart) {
+                out_.resize(mark);
+                return;
+            }
+            if (options_.minify && out_.back() == ';') {
+                out_.pop_back();
+            }
+            indent(depth);
+            out_ += '}';
+            newline();
+        }
+
+        void writeDeclaration(int depth, const std::string& text) {
+            std::size_t colon = scanTopLevel(text, [&](std::size_t i) { return text[i] == ':'; });
+            indent(depth);
+            if (colon == std::string::npos) {
+                out_ += text;
+            } else {
+                std::string_view property = trim(std::string_view(text).substr(0, colon));
+                std::string_view value = trim(std::string_view(text).substr(colon + 1));
+                out_ += property;
+                if (options_.minify) {
+                    out_ += ':';
+                    out_ += compact(value, ",)!", ",(!");
+                } else {
+                    out_ += ": ";
+                    out_ += value;
+                }
+            }
+            out_ += ';';
+            newline();
+        }
+
+        // "@media screen and (max-width: 600px)" -> "@media screen and (max-width:600px)"
+        static std::string compactAtPrelude(const std::string& prelude) {
+            return compact(prelude, ",", ",:");
+        }
+
+        void indent(int depth) {
+            if (!options_.minify) {
+                out_.append(static_cast<std::size_t>(depth) * 4, ' ');
+            }
+        }
+
+        void newline() {
+            if (!options_.minify) {
+                out_ += '\n';
+            }
+        }
+
+        CssTokenizer tokenizer_;
+        CssToken token_;
+        const CssOptions& options_;
+        std::string out_;
+    };
+
+    // Dernier sélecteur composé : attribut inséré avant la première pseudo-classe
+    std::string scopeCompound(std::string_view selector, const std::string& attribute) {
+        std::size_t compoundStart = 0;
+        scanTopLevel(selector, [&](std::size_t i) {
+            char c = selector[i];
+            if (c == ' ' || c == '>' || c == '+' || c == '~') {
+                compoundStart = i + 1;
+            }
+            return false;
+        });
+
+        std::string_view compound = selector.substr(compoundStart);
+        std::size_t pseudo = scanTopLevel(compound, [&](std::size_t i) { return compound[i] == ':'; });
+        std::size_t insertAt = compoundStart + (pseudo == std::string_view::npos ? compound.size() : pseudo);
+
+        std::string result(selector.substr(0, insertAt));
+        result += attribute;
+        result += selector.substr(insertAt);
+        return result;
+    }
+
+    // Position et contenu de la pseudo-classe fonctionnelle name(...) de premier niveau
+    bool findFunctional(std::string_view selector, std::string_view name,
+                        std::size_t& start, std::size_t& end, std::string_view& argument) {
+        start = scanTopLevel(selector, [&](std::size_t i) {
+            return selector.compare(i, name.size(), name) == 0;
+        });
+        if (start == std::string_view::npos) {
+            return false;
+        }
+        std::size_t open = start + name.size();
+        int depth = 1;
+        for (end = open; end < selector.size() && depth > 0; ++end) {
+            if (selector[end] == '(') ++depth;
+            else if (selector[end] == ')') --depth;
+        }
+        argument = trim(selector.substr(open, end - open - (depth == 0 ? 1 : 0)));
+        return true;
+    }
+}
+
+std::string CssProcessor::process(std::string_view css, const CssOptions& options) {
+    return StyleWriter(css, options).run();
+}
+
+std::string CssProcessor::scopeSelector(std::string_view selectors, const std::string& scopeId) {
+    const std::string attribute = "[data-v-" + scopeId + "]";
+    std::string result;
+
+    for (std::string_view selector : splitTopLevel(selectors, ',')) {
+        if (!result.empty()) {
+            result += ", ";
+        }
+
+        std::size_t start, end;
+        std::string_view argument;
+        if (findFunctional(selector, ":global(", start, end, argument)) {
+            result.append(selector.substr(0, start));
+            result.append(argument);
+            result.append(selector.substr(end));
+        } else if (findFunctional(selector, ":deep(", start, end, argument)) {
+            std::string_view before = trim(selector.substr(0, start));
+            result += before.empty() ? attribute : scopeCompound(before, attribute);
+            result += ' ';
+            result.append(argument);
+            result.append(selector.substr(end));
+        } else if (!selector.empty()) {
+            result += scopeCompound(selector, attribute);
+        }
+    }
+    return result;
+}
+
+std::vector<std::string> CssProcessor::splitRules(std::string_view css) {
+    std::vector<std::string> rules;
+    CssTokenizer tokenizer(css);
+    int depth = 0;
+    std::size_t start = std::string_view::npos;
+
+    for (auto token = tokenizer.next(); token.type != Type::END; token = tokenizer.next()) {
+        std::size_t offset = static_cast<std::size_t>(token.value.data() - css.data());
+        if (depth == 0 && start == std::string_view::npos) {
+            if (token.type == Type::WHITESPACE) {
+                continue;
+            }
+            if (token.type == Type::COMMENT) {
+                rules.emplace_back(token.value);
+                continue;
+            }
+            start = offset;
+        }
+
+        bool done = false;
+        if (token.type == Type::OPEN_BRACE) {
+            ++depth;
+        } else if (token.type == Type::CLOSE_BRACE) {
+            depth = std::max(depth - 1, 0);
+            done = depth == 0;
+        } else if (token.type == Type::SEMICOLON) {
+            done = depth == 0;
+        }
+
+        if (done) {
+            rules.emplace_back(css.substr(start, offset + 1 - start));
+            start = std::string_view::npos;
+        }
+    }
+    if (start != std::string_view::npos) {
+        rules.emplace_back(css.substr(start));
+    }
+    return rules;
+}
+
+std::string CssProcessor::bundle(const std::vector<std::string>& stylesheets, bool minify) {
+    std::string charset;
+    std::vector<std::string> imports;
+    std::vector<std::string> rules;
+
+    for (const auto& stylesheet : stylesheets) {
+        for (auto& rule : splitRules(stylesheet)) {
+            if (startsWith(rule, "@charset")) {
+                if (charset.empty()) {
+                    charset = std::move(rule);
+                }
+            } else if (startsWith(rule, "@import")) {
+                if (std::find(imports.begin(), imports.end(), rule) == imports.end()) {
+                    imports.push_back(std::move(rule));
+                }
+            } else {
+                rules.push_back(std::move(rule));
+            }
+        }
+    }
+
+    // Supprimer une occurrence antérieure d'une règle identique ne change pas la cascade
+    std::unordered_map<std::string_view, std::size_t> last;
+    for (std::size_t i = 0; i < rules.size(); ++i) {
+        last[rules[i]] = i;
+    }
+
+    const char* separator = minify ? "" : "\n";
+    std::string out;
+    if (!charset.empty()) {
+        out += charset + separator;
+    }
+    for (const auto& import : imports) {
+        out += import + separator;
+    }
+    for (std::size_t i = 0; i < rules.size(); ++i) {
+        if (last[rules[i]] == i) {
+            out += rules[i] + separator;
+        }
+    }
+    return out;
+}
+
+} // namespace cppvue::compiler
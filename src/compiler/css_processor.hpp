@@ -0,0 +1,35 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace cppvue::compiler {
+
+struct CssOptions {
+    std::string scopeId;    // Non vide : sélecteurs restreints à [data-v-scopeId]
+    bool minify = false;    // Sortie compacte, commentaires retirés (sauf /*! ... */)
+};
+
+// Traitement des feuilles de style des composants, sur les tokens de
+// CssTokenizer : les at-rules, les listes de sélecteurs et les blocs imbriqués
+// sont reconnus, les chaînes et url(...) ne sont jamais modifiées.
+class CssProcessor {
+public:
+    // Scoping et mise en forme (lisible, ou compacte si options.minify)
+    static std::string process(std::string_view css, const CssOptions& options);
+
+    // Ajoute [data-v-scopeId] au dernier sélecteur composé de chaque sélecteur
+    // de la liste. :deep(x) laisse x hors scope, :global(x) n'est pas scopé.
+    static std::string scopeSelector(std::string_view selectors, const std::string& scopeId);
+
+    // Instructions et blocs de premier niveau d'une feuille
+    static std::vector<std::string> splitRules(std::string_view css);
+
+    // Concatène des feuilles issues de process() : @charset et @import en tête,
+    // règles identiques dédupliquées en gardant la dernière occurrence (la
+    // cascade est inchangée)
+    static std::string bundle(const std::vector<std::string>& stylesheets, bool minify);
+};
+
+} // namespace cppvue::compiler
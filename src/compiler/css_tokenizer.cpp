@@ -0,0 +1,106 @@
+#include "css_tokenizer.hpp"
+#include <algorithm>
+#include <cctype>
+
+namespace cppvue::compiler {
+
+namespace {
+    bool isSpace(char c) {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+    }
+
+    bool isIdentChar(char c) {
+        return std::isalnum(static_cast<unsigned char>(c)) || c == '-' || c == '_';
+    }
+
+    // Fin d'une chaîne commençant à pos (guillemet ouvrant), guillemet fermant compris
+    std::size_t skipString(std::string_view source, std::size_t pos) {
+        char quote = source[pos++];
+        while (pos < source.size()) {
+            char c = source[pos++];
+            if (c == '\\') {
+                ++pos;
+            } else if (c == quote || c == '\n') {
+                break;
+            }
+        }
+        return std::min(pos, source.size());
+    }
+}
+
+CssTokenizer::CssTokenizer(std::string_view source)
+    : source_(source) {}
+
+CssToken CssTokenizer::next() {
+    CssToken token;
+    if (pos_ >= source_.size()) {
+        return token;
+    }
+
+    std::size_t start = pos_;
+    char c = source_[pos_];
+
+    if (isSpace(c)) {
+        while (pos_ < source_.size() && isSpace(source_[pos_])) {
+            ++pos_;
+        }
+        token.type = CssToken::Type::WHITESPACE;
+    } else if (c == '/' && pos_ + 1 < source_.size() && source_[pos_ + 1] == '*') {
+        std::size_t end = source_.find("*/", pos_ + 2);
+        pos_ = end == std::string_view::npos ? source_.size() : end + 2;
+        token.type = CssToken::Type::COMMENT;
+    } else if (c == '"' || c == '\'') {
+        pos_ = skipString(source_, pos_);
+        token.type = CssToken::Type::STRING;
+    } else if (c == '{') {
+        ++pos_;
+        token.type = CssToken::Type::OPEN_BRACE;
+    } else if (c == '}') {
+        ++pos_;
+        token.type = CssToken::Type::CLOSE_BRACE;
+    } else if (c == ';') {
+        ++pos_;
+        token.type = CssToken::Type::SEMICOLON;
+    } else {
+        pos_ = readText(pos_);
+        token.type = CssToken::Type::TEXT;
+    }
+
+    token.value = source_.substr(start, pos_ - start);
+    return token;
+}
+
+std::size_t CssTokenizer::readText(std::size_t pos) const {
+    while (pos < source_.size()) {
+        char c = source_[pos];
+        if (isSpace(c) || c == '"' || c == '\'' || c == '{' || c == '}' || c == ';') {
+            break;
+        }
+        if (c == '/' && pos + 1 < source_.size() && source_[pos + 1] == '*') {
+            break;
+        }
+        if (c == '\\') {
+            pos = std::min(pos + 2, source_.size());
+            continue;
+        }
+
+        // url(...) non guillemeté : peut contenir ; et espaces (data:...)
+        if (c == '(' && pos >= 3 && (source_.compare(pos - 3, 3, "url") == 0 ||
+                                     source_.compare(pos - 3, 3, "URL") == 0) &&
+            (pos == 3 || !isIdentChar(source_[pos - 4]))) {
+            std::size_t i = pos + 1;
+            while (i < source_.size() && isSpace(source_[i])) {
+                ++i;
+            }
+            if (i < source_.size() && source_[i] != '"' && source_[i] != '\'') {
+                std::size_t close = source_.find(')', i);
+                pos = close == std::string_view::npos ? source_.size() : close + 1;
+                continue;
+            }
+        }
+        ++pos;
+    }
+    return pos;
+}
+
+} // namespace cppvue::compiler
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+namespace cppvue::compiler {
+
+// Token CSS ; value pointe dans le source
+struct CssToken {
+    enum class Type {
+        WHITESPACE,     // Suite d'espaces
+        COMMENT,        // /* ... */
+        STRING,         // "..." ou '...' (guillemets compris)
+        TEXT,           // Tout le reste, url(...) compris
+        OPEN_BRACE,     // {
+        CLOSE_BRACE,    // }
+        SEMICOLON,      // ;
+        END             // Fin du source
+    };
+
+    Type type = Type::END;
+    std::string_view value;
+};
+
+// Tokenizer CSS à passe unique sur string_view, sans allocation. Suffisant
+// pour retrouver la structure règles / blocs / déclarations ; le contenu des
+// sélecteurs et des valeurs reste du texte.
+class CssTokenizer {
+public:
+    explicit CssTokenizer(std::string_view source);
+
+    // Token suivant (END à la fin du source)
+    CssToken next();
+
+private:
+    std::size_t readText(std::size_t pos) const;
+
+    std::string_view source_;
+    std::size_t pos_ = 0;
+};
+
+} // namespace cppvue::compiler
@@ -1,14 +1,20 @@
 #include "cvue_compiler.hpp"
+#include "template_parser.hpp"
+#include "render_codegen.hpp"
+#include "css_processor.hpp"
+#include "build_cache.hpp"
+#include "file_io.hpp"
+#include "phase_profiler.hpp"
+#include <algorithm>
+#include <cctype>
 #include <fstream>
 #include <sstream>
 #include <regex>
 
 namespace cppvue::compiler {
 
-CvueFileContent CvueCompiler::parseCvueFile(const std::string& content) {
+CvueFileContent CvueCompiler::parseCvueFile(std::string_view content) {
     CvueFileContent result;
-    std::istringstream stream(content);
-    std::string line;
     
     enum class Section {
         None,
@@ -17,126 +23,333 @@ CvueFileContent CvueCompiler::parseCvueFile(const std::string& content) {
         Style
     } currentSection = Section::None;
     
-    std::stringstream currentContent;
-    
-    while (std::getline(stream, line)) {
-        if (isTemplateStart(line)) {
-            currentSection = Section::Template;
+    // Les lignes de contenu consécutives sont copiées d'un bloc depuis le
+    // source, à la ligne de marqueur suivante
+    std::string currentContent;
+    std::size_t runStart = 0;
+    std::size_t pos = 0;
+    while (pos < content.size()) {
+        std::size_t lineEnd = std::min(content.find('\n', pos), content.size());
+        std::string_view line = content.substr(pos, lineEnd - pos);
+        std::size_t lineStart = pos;
+        pos = lineEnd + 1;
+        
+        bool templateStart = isTemplateStart(line);
+        bool cppStart = !templateStart && isCppStart(line);
+        bool styleStart = !templateStart && !cppStart && isStyleStart(line);
+        if (!templateStart && !cppStart && !styleStart && !isSectionEnd(line)) {
             continue;
-        } else if (isCppStart(line)) {
+        }
+        if (currentSection != Section::None) {
+            currentContent.append(content.substr(runStart, lineStart - runStart));
+        }
+        runStart = pos;
+        
+        if (templateStart) {
+            currentSection = Section::Template;
+        } else if (cppStart) {
             currentSection = Section::Cpp;
-            continue;
-        } else if (isStyleStart(line)) {
+        } else if (styleStart) {
             currentSection = Section::Style;
-            result.style_scoped = (line.find("scoped") != std::string::npos);
-            continue;
-        } else if (isSectionEnd(line)) {
+            result.style_scoped = (line.find("scoped") != std::string_view::npos);
+        } else {
             switch (currentSection) {
                 case Section::Template:
-                    result.template_content = currentContent.str();
+                    result.template_content = std::move(currentContent);
                     break;
                 case Section::Cpp:
-                    result.cpp_content = currentContent.str();
+                    result.cpp_content = std::move(currentContent);
                     break;
                 case Section::Style:
-                    result.style_content = currentContent.str();
+                    result.style_content = std::move(currentContent);
                     break;
                 default:
                     break;
             }
-            currentContent.str("");
             currentContent.clear();
             currentSection = Section::None;
-            continue;
-        }
-        
-        if (currentSection != Section::None) {
-            currentContent << line << "\n";
         }
     }
     
     return result;
 }
 
-std::string CvueCompiler::generateCppCode(const CvueFileContent& content, const std::string& className) {
+namespace {
+    // Attribut de scope sur chaque élément DOM (pas sur les composants ni les <template>)
+    void addScopeAttribute(TemplateAst& ast, TemplateNode& node, const std::string& attribute) {
+        if (node.type != TemplateNode::Type::ELEMENT) {
+            return;
+        }
+        if (node.tag != "template" && !TemplateParser::isComponentTag(node.tag)) {
+            ast.setAttribute(node, attribute, "");
+        }
+        for (auto* child : node.children) {
+            addScopeAttribute(ast, *child, attribute);
+        }
+    }
+}
+
+std::string CvueCompiler::generateCppCode(const CvueFileContent& content, const std::string& className,
+                                          const std::string& scopeId, bool compact,
+                                          CodeSizeStats* stats) {
     std::stringstream result;
     
     // Génère le code pour le template
-    std::string parsedTemplate = parseTemplate(content.template_content);
-    std::string templateCode = generateTemplateCode(parsedTemplate);
+    std::optional<TemplateAst> ast;
+    {
+        PhaseScope phase("template");
+        ast.emplace(parseTemplate(content.template_content));
+    }
+    PhaseScope phase("codegen");
+    std::string scopeAttribute;
+    if (content.style_scoped && !scopeId.empty()) {
+        scopeAttribute = "data-v-" + scopeId;
+        addScopeAttribute(*ast, ast->root(), scopeAttribute);
+    }
+    std::string staticData;
+    std::string templateCode = generateTemplateCode(ast->root(), className, compact, scopeAttribute,
+                                                    collectSymbols(content.cpp_content, className),
+                                                    staticData, stats);
     
     // Combine le code C++ et le template
     result << "#include <cppvue/component.hpp>\n";
-    result << "#include <cppvue/template.hpp>\n\n";
-    result << content.cpp_content << "\n\n";
+    result << "#include <cppvue/render_helpers.hpp>\n";
+    result << "#include <cppvue/static_template.hpp>\n";
+    result << "#ifdef ENABLE_HOT_RELOAD\n#include <cppvue/hot_reload.hpp>\n#endif\n\n";
+    result << declareRender(content.cpp_content, className) << "\n\n";
+    
+    // Squelettes des c-for, enregistrés au chargement du module
+    std::string registrations = TemplateParser::generateTemplateRegistrations(ast->root());
+    if (!registrations.empty()) {
+        result << registrations << "\n";
+    }
+    
+    // Blobs statiques du mode compact, partagés entre composants
+    if (!staticData.empty()) {
+        result << staticData << "\n";
+    }
     
     // Ajoute la méthode de rendu générée
-    result << "std::shared_ptr<VNode> " << className << "::render() override {\n";
-    result << "    return " << templateCode << ";\n";
-    result << "}\n";
+    result << wrapRenderFunction(templateCode, className, scriptHash(content));
     
     return result.str();
 }
 
-std::string CvueCompiler::generateCssCode(const CvueFileContent& content, const std::string& componentId) {
-    if (!content.style_scoped) {
-        return content.style_content;
+std::uint64_t CvueCompiler::scriptHash(const CvueFileContent& content) {
+    return BuildCache::hashBytes(content.cpp_content);
+}
+
+std::string CvueCompiler::generateCssCode(const CvueFileContent& content, const std::string& componentId,
+                                          bool minify) {
+    PhaseScope phase("css");
+    CssOptions options;
+    options.scopeId = content.style_scoped ? componentId : "";
+    options.minify = minify;
+    return CssProcessor::process(content.style_content, options);
+}
+
+// Les sections s'écrivent @template/@cpp/@style ... @end, ou comme en Vue
+// <template>/<script>/<style> en début de ligne
+namespace {
+    bool startsWith(std::string_view line, std::string_view prefix) {
+        return line.substr(0, prefix.size()) == prefix;
     }
-    
-    // Ajoute l'attribut data-v-{componentId} à chaque sélecteur
-    std::regex selectorRegex("([^{]+)({[^}]*})");
-    std::string result = content.style_content;
-    std::string replacement = "$1[data-v-" + componentId + "]$2";
-    
-    return std::regex_replace(result, selectorRegex, replacement);
 }
 
-bool CvueCompiler::isTemplateStart(const std::string& line) {
-    return line.find("@template") != std::string::npos;
+bool CvueCompiler::isTemplateStart(std::string_view line) {
+    return line.find("@template") != std::string_view::npos || startsWith(line, "<template>");
+}
+
+bool CvueCompiler::isCppStart(std::string_view line) {
+    return line.find("@cpp") != std::string_view::npos || startsWith(line, "<script");
+}
+
+bool CvueCompiler::isStyleStart(std::string_view line) {
+    return line.find("@style") != std::string_view::npos || startsWith(line, "<style");
 }
 
-bool CvueCompiler::isCppStart(const std::string& line) {
-    return line.find("@cpp") != std::string::npos;
+bool CvueCompiler::isSectionEnd(std::string_view line) {
+    return line.find("@end") != std::string_view::npos || startsWith(line, "</template>") ||
+           startsWith(line, "</script>") || startsWith(line, "</style>");
 }
 
-bool CvueCompiler::isStyleStart(const std::string& line) {
-    return line.find("@style") != std::string::npos;
+TemplateAst CvueCompiler::parseTemplate(std::string_view template_content) {
+    return TemplateParser::parse(template_content);
 }
 
-bool CvueCompiler::isSectionEnd(const std::string& line) {
-    return line.find("@end") != std::string::npos;
+std::string CvueCompiler::generateTemplateCode(const TemplateNode& root, const std::string& className,
+                                               bool compact, const std::string& scopeAttribute,
+                                               const ComponentSymbols& symbols,
+                                               std::string& staticData, CodeSizeStats* stats) {
+    RenderCodeGenerator generator(compact, scopeAttribute, symbols);
+    std::string body = generator.generateBody(root);
+    staticData = generator.staticData();
+    if (stats != nullptr) {
+        *stats = generator.stats();
+    }
+    return "std::shared_ptr<cppvue::VNode> " + className + "::render() {\n" + body + "}\n";
 }
 
-std::string CvueCompiler::parseTemplate(const std::string& template_content) {
-    // Implémentation du parsing du template
-    // Convertit le HTML en appels de la méthode h()
-    // TODO: Implémenter un parser HTML complet
-    return template_content;
+ComponentSymbols CvueCompiler::collectSymbols(const std::string& cpp_content, const std::string& className) {
+    ComponentSymbols symbols;
+    std::regex classRegex("\\b(class|struct)\\s+" + className + "\\b[^;{]*\\{");
+    std::smatch match;
+    if (!std::regex_search(cpp_content, match, classRegex)) {
+        return symbols;
+    }
+    // Une autre base que Component peut apporter des membres inconnus ici
+    std::string bases = match.str(0);
+    std::size_t colon = bases.find(':');
+    if (colon != std::string::npos &&
+        std::regex_replace(bases.substr(colon), std::regex("[\\s:{,]|public|cppvue|Component"), "") != "") {
+        return symbols;
+    }
+    symbols.known = true;
+    
+    // Identifiants au niveau du corps de classe (hors corps de méthodes,
+    // paramètres, commentaires et littéraux) : noms de membres, plus quelques
+    // noms de types et mots-clés sans conséquence
+    static const std::regex propRegex("^\\s*CPPVUE_PROP\\s*\\(.*,\\s*(\\w+)\\s*\\)$");
+    std::size_t pos = match.position(0) + match.length(0);
+    int braces = 0;
+    int parens = 0;
+    std::size_t macroStart = std::string::npos;
+    while (pos < cpp_content.size()) {
+        char c = cpp_content[pos];
+        if (cpp_content.compare(pos, 2, "//") == 0) {
+            pos = cpp_content.find('\n', pos);
+            continue;
+        }
+        if (cpp_content.compare(pos, 2, "/*") == 0) {
+            pos = cpp_content.find("*/", pos);
+            pos = pos == std::string::npos ? pos : pos + 2;
+            continue;
+        }
+        if (c == '"' || c == '\'') {
+            for (++pos; pos < cpp_content.size() && cpp_content[pos] != c; ++pos) {
+                if (cpp_content[pos] == '\\') ++pos;
+            }
+            ++pos;
+            continue;
+        }
+        if (c == '{') ++braces;
+        else if (c == '}' && braces-- == 0) break;
+        else if (c == '(' && braces == 0) ++parens;
+        else if (c == ')' && braces == 0 && --parens == 0 && macroStart != std::string::npos) {
+            std::smatch prop;
+            std::string macro = cpp_content.substr(macroStart, pos + 1 - macroStart);
+            if (std::regex_match(macro, prop, propRegex)) {
+                symbols.props.insert(prop.str(1));
+            }
+            macroStart = std::string::npos;
+        }
+        if (std::isalpha(static_cast<unsigned char>(c)) || c == '_') {
+            std::size_t end = pos;
+            while (end < cpp_content.size() &&
+                   (std::isalnum(static_cast<unsigned char>(cpp_content[end])) || cpp_content[end] == '_')) {
+                ++end;
+            }
+            if (braces == 0 && parens == 0) {
+                std::string name = cpp_content.substr(pos, end - pos);
+                if (name == "CPPVUE_PROP") {
+                    macroStart = pos;
+                } else {
+                    symbols.members.insert(std::move(name));
+                }
+            }
+            pos = end;
+            continue;
+        }
+        ++pos;
+    }
+    return symbols;
 }
 
-std::string CvueCompiler::generateTemplateCode(const std::string& parsed_template) {
-    // Génère le code C++ pour le template
-    // TODO: Implémenter la génération de code complète
-    return "h(\"div\", \"Template not implemented yet\")";
+std::string CvueCompiler::declareRender(const std::string& cpp_content, const std::string& className) {
+    // Recherche de la définition "class ClassName ... {"
+    std::regex classRegex("\\b(class|struct)\\s+" + className + "\\b[^;{]*\\{");
+    std::smatch match;
+    if (!std::regex_search(cpp_content, match, classRegex)) {
+        return cpp_content;
+    }
+    
+    // Accolade fermante correspondante
+    std::size_t bodyStart = match.position(0) + match.length(0);
+    std::size_t pos = bodyStart;
+    int depth = 1;
+    for (; pos < cpp_content.size() && depth > 0; ++pos) {
+        if (cpp_content[pos] == '{') ++depth;
+        else if (cpp_content[pos] == '}') --depth;
+    }
+    if (depth != 0) {
+        return cpp_content;
+    }
+    std::size_t bodyEnd = pos - 1;
+    
+    static const std::regex renderRegex("\\brender\\s*\\(");
+    std::string body = cpp_content.substr(bodyStart, bodyEnd - bodyStart);
+    std::string declarations = "\npublic:\n";
+    if (!std::regex_search(body, renderRegex)) {
+        declarations += "    std::shared_ptr<cppvue::VNode> render() override;\n";
+    }
+    
+    // Non virtuelle : la disposition de la classe ne dépend pas du hot reload
+    declarations += "#ifdef ENABLE_HOT_RELOAD\n";
+    declarations += "    CPPVUE_HOT_LOCAL std::shared_ptr<cppvue::VNode> renderTemplate();\n";
+    declarations += "#endif\n";
+    
+    return cpp_content.substr(0, bodyEnd) + declarations + cpp_content.substr(bodyEnd);
+}
+
+std::string CvueCompiler::wrapRenderFunction(const std::string& renderFunction, const std::string& className,
+                                             std::uint64_t scriptHash) {
+    // Avec ENABLE_HOT_RELOAD, le corps généré devient renderTemplate() et render()
+    // passe par HotReload. Le même fichier compilé avec CPPVUE_HOT_MODULE forme
+    // le module rechargé : il n'enregistre que son renderTemplate()
+    std::size_t signatureEnd = renderFunction.find('\n');
+    std::string body = renderFunction.substr(signatureEnd + 1);
+    std::ostringstream hash;
+    hash << "0x" << std::hex << scriptHash << "ULL";
+    
+    std::stringstream ss;
+    ss << "#ifdef ENABLE_HOT_RELOAD\n";
+    ss << "#ifndef CPPVUE_HOT_MODULE\n";
+    ss << "std::shared_ptr<cppvue::VNode> " << className << "::render() {\n";
+    ss << "    if (auto* hot = cppvue::HotReload::instance().enter(\"" << className << "\", *this)) {\n";
+    ss << "        return (*hot)(*this);\n";
+    ss << "    }\n";
+    ss << "    return renderTemplate();\n";
+    ss << "}\n\n";
+    ss << "static const bool " << className << "_hotLayout = cppvue::HotReload::instance().registerLayout(\""
+       << className << "\", " << hash.str() << ");\n";
+    ss << "#else\n";
+    ss << "static const bool " << className << "_hotRender = cppvue::HotReload::instance().registerRender(\""
+       << className << "\", " << hash.str() << ",\n";
+    ss << "    [](cppvue::Component& self) { return static_cast<" << className << "&>(self).renderTemplate(); });\n";
+    ss << "#endif\n\n";
+    ss << "std::shared_ptr<cppvue::VNode> " << className << "::renderTemplate() {\n";
+    ss << "#else\n";
+    ss << renderFunction.substr(0, signatureEnd + 1);
+    ss << "#endif\n";
+    ss << body;
+    return ss.str();
 }
 
 bool CvueFileCompiler::compileFile(const std::filesystem::path& cvue_file, 
                                  const std::filesystem::path& output_dir) {
     try {
-        // Lit le fichier .cvue
-        std::string content = readFile(cvue_file);
-        
-        // Parse le contenu
-        auto cvueContent = CvueCompiler::parseCvueFile(content);
+        // Parse le fichier .cvue, lu sans copie
+        MappedFile source(cvue_file);
+        auto cvueContent = CvueCompiler::parseCvueFile(source.view());
         
         // Génère le nom de la classe
         std::string className = generateClassName(cvue_file);
         
         // Génère le code C++
-        std::string cppCode = CvueCompiler::generateCppCode(cvueContent, className);
+        std::string componentId = className + "_" + std::to_string(std::hash<std::string>{}(className));
+        std::string cppCode = CvueCompiler::generateCppCode(cvueContent, className, componentId);
         
         // Génère le code CSS
-        std::string componentId = className + "_" + std::to_string(std::hash<std::string>{}(className));
         std::string cssCode = CvueCompiler::generateCssCode(cvueContent, componentId);
         
         // Écrit les fichiers générés
@@ -158,20 +371,11 @@ std::string CvueFileCompiler::generateClassName(const std::filesystem::path& cvu
 }
 
 std::string CvueFileCompiler::readFile(const std::filesystem::path& path) {
-    std::ifstream file(path);
-    if (!file.is_open()) {
-        throw std::runtime_error("Cannot open file: " + path.string());
-    }
-    return std::string(std::istreambuf_iterator<char>(file),
-                      std::istreambuf_iterator<char>());
+    return compiler::readFile(path);
 }
 
 void CvueFileCompiler::writeFile(const std::filesystem::path& path, const std::string& content) {
-    std::ofstream file(path);
-    if (!file.is_open()) {
-        throw std::runtime_error("Cannot write file: " + path.string());
-    }
-    file << content;
+    writeFileIfChanged(path, content);
 }
 
 } // namespace cppvue::compiler
@@ -1,12 +1,24 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
+#include <memory>
 #include <optional>
 #include <filesystem>
 
 namespace cppvue::compiler {
 
+struct TemplateNode;
+struct CodeSizeStats;
+struct ComponentSymbols;
+class TemplateAst;
+
+// Version du générateur, à incrémenter quand le code produit change :
+// elle fait partie de la clé du cache de build
+inline constexpr const char* COMPILER_VERSION = "0.3.4";
+
 struct CvueFileContent {
     std::string template_content;
     std::string cpp_content;
@@ -17,23 +29,48 @@ struct CvueFileContent {
 class CvueCompiler {
 public:
     // Parse un fichier .cvue
-    static CvueFileContent parseCvueFile(const std::string& content);
+    static CvueFileContent parseCvueFile(std::string_view content);
+    
+    // Génère le code C++ final ; avec <style scoped>, les éléments du template
+    // reçoivent l'attribut data-v-scopeId utilisé par generateCssCode.
+    // compact : structure statique encodée en blobs partagés (cvuec --compact) ;
+    // stats reçoit la contribution du composant au code généré
+    static std::string generateCppCode(const CvueFileContent& content, const std::string& className,
+                                       const std::string& scopeId = "", bool compact = false,
+                                       CodeSizeStats* stats = nullptr);
     
-    // Génère le code C++ final
-    static std::string generateCppCode(const CvueFileContent& content, const std::string& className);
+    // Hash du script : le hot reload ne remplace le rendu d'un composant que
+    // si la classe compilée dans le programme a le même script
+    static std::uint64_t scriptHash(const CvueFileContent& content);
     
-    // Génère le code CSS avec support du scoping
-    static std::string generateCssCode(const CvueFileContent& content, const std::string& componentId);
+    // Génère le code CSS : sélecteurs restreints à [data-v-componentId] pour
+    // <style scoped>, sortie compacte si minify
+    static std::string generateCssCode(const CvueFileContent& content, const std::string& componentId,
+                                       bool minify = false);
 
 private:
-    static std::string parseTemplate(const std::string& template_content);
-    static std::string generateTemplateCode(const std::string& parsed_template);
+    static TemplateAst parseTemplate(std::string_view template_content);
+    static std::string generateTemplateCode(const TemplateNode& root, const std::string& className,
+                                            bool compact, const std::string& scopeAttribute,
+                                            const ComponentSymbols& symbols,
+                                            std::string& staticData, CodeSizeStats* stats);
+    
+    // Membres et props (CPPVUE_PROP) déclarés dans le corps de la classe du composant
+    static ComponentSymbols collectSymbols(const std::string& cpp_content, const std::string& className);
+    
+    // Ajoute la déclaration de render() à la classe du composant si elle manque,
+    // et celle de renderTemplate() utilisée par le hot reload
+    static std::string declareRender(const std::string& cpp_content, const std::string& className);
+    
+    // render() générée : directement, ou via HotReload avec ENABLE_HOT_RELOAD
+    static std::string wrapRenderFunction(const std::string& renderFunction, const std::string& className,
+                                          std::uint64_t scriptHash);
     
     // Helpers pour parser les sections
-    static bool isTemplateStart(const std::string& line);
-    static bool isCppStart(const std::string& line);
-    static bool isStyleStart(const std::string& line);
-    static bool isSectionEnd(const std::string& line);
+    static bool isTemplateStart(std::string_view line);
+    static bool isCppStart(std::string_view line);
+    static bool isStyleStart(std::string_view line);
+    static bool isSectionEnd(std::string_view line);
 };
 
 // Utilitaire pour compiler les fichiers .cvue
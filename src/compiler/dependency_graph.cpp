@@ -0,0 +1,363 @@
+#include "dependency_graph.hpp"
+#include "build_cache.hpp"
+#include "cvue_compiler.hpp"
+#include "file_io.hpp"
+#include "template_parser.hpp"
+#include "template_tokenizer.hpp"
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <optional>
+#include <set>
+#include <unordered_set>
+
+namespace cppvue::compiler {
+
+namespace {
+    // Noms des #include "..." (les #include <...> sont externes au projet)
+    std::vector<std::string> quotedIncludes(std::string_view content) {
+        std::vector<std::string> result;
+        std::size_t pos = 0;
+        while ((pos = content.find('#', pos)) != std::string_view::npos) {
+            std::size_t i = pos + 1;
+            pos = i;
+
+            // Le # doit être le premier caractère non blanc de sa ligne
+            std::size_t lineStart = content.rfind('\n', i - 1);
+            lineStart = lineStart == std::string_view::npos ? 0 : lineStart + 1;
+            if (content.find_first_not_of(" \t", lineStart) != i - 1) {
+                continue;
+            }
+
+            while (i < content.size() && (content[i] == ' ' || content[i] == '\t')) {
+                ++i;
+            }
+            if (content.compare(i, 7, "include") != 0) {
+                continue;
+            }
+            i += 7;
+            while (i < content.size() && (content[i] == ' ' || content[i] == '\t')) {
+                ++i;
+            }
+            if (i >= content.size() || content[i] != '"') {
+                continue;
+            }
+            std::size_t end = content.find_first_of("\"\n", i + 1);
+            if (end != std::string_view::npos && content[end] == '"') {
+                result.emplace_back(content.substr(i + 1, end - i - 1));
+            }
+        }
+        return result;
+    }
+
+    void insertSorted(std::vector<std::string>& keys, const std::string& value) {
+        auto it = std::lower_bound(keys.begin(), keys.end(), value);
+        if (it == keys.end() || *it != value) {
+            keys.insert(it, value);
+        }
+    }
+
+    void eraseSorted(std::vector<std::string>& keys, const std::string& value) {
+        auto it = std::lower_bound(keys.begin(), keys.end(), value);
+        if (it != keys.end() && *it == value) {
+            keys.erase(it);
+        }
+    }
+}
+
+std::string DependencyGraph::key(const std::filesystem::path& file) {
+    return file.lexically_normal().generic_string();
+}
+
+void DependencyGraph::build(const std::vector<std::filesystem::path>& components,
+                            const std::vector<std::filesystem::path>& includeDirs) {
+    nodes_.clear();
+    componentsByName_.clear();
+    includeDirs_ = includeDirs;
+    invalidate();
+
+    // Tous les composants d'abord, pour que les tags se résolvent quel que soit l'ordre
+    for (const auto& component : components) {
+        std::string nodeKey = key(component);
+        Node& node = nodes_[nodeKey];
+        node.path = component.lexically_normal();
+        node.component = true;
+        componentsByName_.emplace(component.stem().string(), nodeKey);
+    }
+
+    for (const auto& component : components) {
+        scan(key(component));
+    }
+}
+
+void DependencyGraph::update(const std::filesystem::path& file) {
+    std::string nodeKey = key(file);
+    if (nodes_.count(nodeKey) == 0) {
+        return;
+    }
+    scan(nodeKey);
+    invalidate();
+}
+
+bool DependencyGraph::contains(const std::filesystem::path& file) const {
+    auto it = nodes_.find(key(file));
+    return it != nodes_.end() && it->second.exists;
+}
+
+void DependencyGraph::scan(const std::string& nodeKey) {
+    // Les références restent valides quand la table grandit
+    Node& node = nodes_.at(nodeKey);
+    unlink(nodeKey);
+
+    std::optional<MappedFile> file;
+    try {
+        file.emplace(node.path);
+    } catch (const std::exception&) {
+        node.exists = false;
+        node.contentHash = 0;
+        return;
+    }
+    std::string_view content = file->view();
+    node.exists = true;
+    node.contentHash = BuildCache::hashBytes(content);
+
+    std::set<std::string> dependencies;
+    for (const auto& include : quotedIncludes(content)) {
+        std::string resolved = resolveInclude(node.path, include);
+        if (!resolved.empty() && resolved != nodeKey) {
+            dependencies.insert(resolved);
+        }
+    }
+
+    if (node.component) {
+        std::string templateContent = CvueCompiler::parseCvueFile(content).template_content;
+        TemplateTokenizer tokenizer(templateContent);
+        for (auto token = tokenizer.next(); token.type != TemplateToken::Type::END; token = tokenizer.next()) {
+            if (token.type != TemplateToken::Type::OPEN_TAG) {
+                continue;
+            }
+            std::string tag(token.value);
+            if (!TemplateParser::isComponentTag(tag)) {
+                continue;
+            }
+            auto it = componentsByName_.find(TemplateParser::componentClassName(tag));
+            if (it != componentsByName_.end() && it->second != nodeKey) {
+                dependencies.insert(it->second);
+            }
+        }
+    }
+
+    node.dependencies.assign(dependencies.begin(), dependencies.end());
+    for (const auto& dependency : node.dependencies) {
+        auto [it, inserted] = nodes_.try_emplace(dependency);
+        if (inserted) {
+            // En-tête pas encore vu : on le lit à son tour
+            it->second.path = dependency;
+            scan(dependency);
+        }
+        insertSorted(it->second.dependents, nodeKey);
+    }
+}
+
+std::string DependencyGraph::resolveInclude(const std::filesystem::path& from, const std::string& include) const {
+    std::error_code ec;
+    auto candidate = from.parent_path() / include;
+    if (std::filesystem::is_regular_file(candidate, ec)) {
+        return key(candidate);
+    }
+    for (const auto& dir : includeDirs_) {
+        candidate = dir / include;
+        if (std::filesystem::is_regular_file(candidate, ec)) {
+            return key(candidate);
+        }
+    }
+    return {};
+}
+
+void DependencyGraph::unlink(const std::string& nodeKey) {
+    Node& node = nodes_.at(nodeKey);
+    for (const auto& dependency : node.dependencies) {
+        auto it = nodes_.find(dependency);
+        if (it != nodes_.end()) {
+            eraseSorted(it->second.dependents, nodeKey);
+        }
+    }
+    node.dependencies.clear();
+}
+
+void DependencyGraph::invalidate() const {
+    hashes_.clear();
+    ranks_.clear();
+}
+
+std::vector<std::filesystem::path> DependencyGraph::dependencies(const std::filesystem::path& file) const {
+    std::vector<std::filesystem::path> result;
+    auto it = nodes_.find(key(file));
+    if (it != nodes_.end()) {
+        for (const auto& dependency : it->second.dependencies) {
+            result.push_back(nodes_.at(dependency).path);
+        }
+    }
+    return result;
+}
+
+std::vector<std::filesystem::path> DependencyGraph::dependents(const std::filesystem::path& file) const {
+    std::vector<std::filesystem::path> result;
+    auto it = nodes_.find(key(file));
+    if (it != nodes_.end()) {
+        for (const auto& dependent : it->second.dependents) {
+            result.push_back(nodes_.at(dependent).path);
+        }
+    }
+    return result;
+}
+
+std::uint64_t DependencyGraph::hash(const std::filesystem::path& file) const {
+    std::unordered_set<std::string> visiting;
+
+    std::function<std::uint64_t(const std::string&)> combined = [&](const std::string& nodeKey) {
+        auto cached = hashes_.find(nodeKey);
+        if (cached != hashes_.end()) {
+            return cached->second;
+        }
+        const Node& node = nodes_.at(nodeKey);
+        if (!visiting.insert(nodeKey).second) {
+            return node.contentHash;  // Cycle : déjà signalé par findCycle
+        }
+
+        // Contenu du fichier puis hash combiné de chaque dépendance, dans l'ordre des clés
+        std::string buffer(8 * (node.dependencies.size() + 1), '\0');
+        std::memcpy(buffer.data(), &node.contentHash, 8);
+        for (std::size_t i = 0; i < node.dependencies.size(); ++i) {
+            std::uint64_t dependencyHash = combined(node.dependencies[i]);
+            std::memcpy(buffer.data() + 8 * (i + 1), &dependencyHash, 8);
+        }
+
+        std::uint64_t result = BuildCache::hashBytes(buffer);
+        visiting.erase(nodeKey);
+        hashes_[nodeKey] = result;
+        return result;
+    };
+
+    std::string nodeKey = key(file);
+    return nodes_.count(nodeKey) ? combined(nodeKey) : 0;
+}
+
+const std::unordered_map<std::string, std::size_t>& DependencyGraph::ranks() const {
+    if (!ranks_.empty() || nodes_.empty()) {
+        return ranks_;
+    }
+
+    // Parcours en profondeur post-ordre, racines et arêtes par clé croissante
+    std::vector<const std::string*> roots;
+    for (const auto& [nodeKey, node] : nodes_) {
+        roots.push_back(&nodeKey);
+    }
+    std::sort(roots.begin(), roots.end(), [](const auto* a, const auto* b) { return *a < *b; });
+
+    std::unordered_set<std::string> visited;
+    std::function<void(const std::string&)> visit = [&](const std::string& nodeKey) {
+        if (!visited.insert(nodeKey).second) {
+            return;
+        }
+        for (const auto& dependency : nodes_.at(nodeKey).dependencies) {
+            visit(dependency);
+        }
+        ranks_[nodeKey] = ranks_.size();
+    };
+    for (const auto* root : roots) {
+        visit(*root);
+    }
+    return ranks_;
+}
+
+std::vector<std::filesystem::path> DependencyGraph::topologicalOrder(std::vector<std::filesystem::path> files) const {
+    const auto& rank = ranks();
+    auto rankOf = [&](const std::filesystem::path& file) {
+        auto it = rank.find(key(file));
+        return it != rank.end() ? it->second : rank.size();
+    };
+    std::stable_sort(files.begin(), files.end(), [&](const auto& a, const auto& b) {
+        auto ra = rankOf(a);
+        auto rb = rankOf(b);
+        return ra != rb ? ra < rb : a < b;
+    });
+    return files;
+}
+
+std::vector<std::filesystem::path> DependencyGraph::affected(const std::vector<std::filesystem::path>& changed) const {
+    std::unordered_set<std::string> seen;
+    std::vector<std::string> queue;
+    for (const auto& file : changed) {
+        std::string nodeKey = key(file);
+        if (nodes_.count(nodeKey) && seen.insert(nodeKey).second) {
+            queue.push_back(nodeKey);
+        }
+    }
+
+    std::vector<std::filesystem::path> result;
+    for (std::size_t i = 0; i < queue.size(); ++i) {
+        const Node& node = nodes_.at(queue[i]);
+        if (node.component && node.exists) {
+            result.push_back(node.path);
+        }
+        for (const auto& dependent : node.dependents) {
+            if (seen.insert(dependent).second) {
+                queue.push_back(dependent);
+            }
+        }
+    }
+    return topologicalOrder(std::move(result));
+}
+
+std::vector<std::filesystem::path> DependencyGraph::findCycle() const {
+    std::vector<const std::string*> roots;
+    for (const auto& [nodeKey, node] : nodes_) {
+        roots.push_back(&nodeKey);
+    }
+    std::sort(roots.begin(), roots.end(), [](const auto* a, const auto* b) { return *a < *b; });
+
+    // Les inclusions mutuelles d'en-têtes (#pragma once) sont tolérées :
+    // seul un cycle passant par un composant est une erreur
+    enum class State { Visiting, Done };
+    std::unordered_map<std::string, State> state;
+    std::vector<std::string> stack;
+    std::vector<std::filesystem::path> cycle;
+
+    std::function<bool(const std::string&)> visit = [&](const std::string& nodeKey) {
+        state[nodeKey] = State::Visiting;
+        stack.push_back(nodeKey);
+        for (const auto& dependency : nodes_.at(nodeKey).dependencies) {
+            auto it = state.find(dependency);
+            if (it == state.end()) {
+                if (visit(dependency)) {
+                    return true;
+                }
+            } else if (it->second == State::Visiting) {
+                auto start = std::find(stack.begin(), stack.end(), dependency);
+                bool throughComponent = std::any_of(start, stack.end(), [&](const std::string& k) {
+                    return nodes_.at(k).component;
+                });
+                if (throughComponent) {
+                    for (auto k = start; k != stack.end(); ++k) {
+                        cycle.push_back(nodes_.at(*k).path);
+                    }
+                    cycle.push_back(nodes_.at(dependency).path);
+                    return true;
+                }
+            }
+        }
+        stack.pop_back();
+        state[nodeKey] = State::Done;
+        return false;
+    };
+
+    for (const auto* root : roots) {
+        if (state.count(*root) == 0 && visit(*root)) {
+            break;
+        }
+    }
+    return cycle;
+}
+
+} // namespace cppvue::compiler
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace cppvue::compiler {
+
+// Graphe des dépendances entre fichiers du projet. Les nœuds sont les
+// composants .cvue et les en-têtes qu'ils incluent entre guillemets ; une arête
+// va d'un fichier vers ce qu'il utilise (#include "..." résolu sur le disque,
+// <NomComposant> résolu vers le .cvue de ce composant). Les arêtes inverses
+// donnent les fichiers à reconstruire quand un fichier change.
+class DependencyGraph {
+public:
+    // Reconstruit le graphe : lit chaque composant, puis transitivement les
+    // en-têtes inclus (cherchés à côté du fichier, puis dans includeDirs)
+    void build(const std::vector<std::filesystem::path>& components,
+               const std::vector<std::filesystem::path>& includeDirs);
+
+    // Relit un fichier déjà connu. Un en-tête supprimé reste dans le graphe
+    // (sans contenu) pour que ses dépendants restent invalidés.
+    void update(const std::filesystem::path& file);
+
+    bool contains(const std::filesystem::path& file) const;
+
+    std::vector<std::filesystem::path> dependencies(const std::filesystem::path& file) const;
+    std::vector<std::filesystem::path> dependents(const std::filesystem::path& file) const;
+
+    // Hash du contenu du fichier et de toutes ses dépendances transitives
+    std::uint64_t hash(const std::filesystem::path& file) const;
+
+    // Composants touchés par un changement de ces fichiers (eux compris),
+    // dépendances avant dépendants
+    std::vector<std::filesystem::path> affected(const std::vector<std::filesystem::path>& changed) const;
+
+    // Trie des fichiers du graphe : dépendances avant dépendants
+    std::vector<std::filesystem::path> topologicalOrder(std::vector<std::filesystem::path> files) const;
+
+    // Premier cycle trouvé (a -> b -> a), vide si le graphe est acyclique.
+    // Un composant récursif (qui s'utilise lui-même) n'est pas un cycle.
+    std::vector<std::filesystem::path> findCycle() const;
+
+private:
+    struct Node {
+        std::filesystem::path path;
+        bool component = false;
+        bool exists = true;
+        std::uint64_t contentHash = 0;
+        std::vector<std::string> dependencies;   // Clés triées
+        std::vector<std::string> dependents;     // Clés triées
+    };
+
+    static std::string key(const std::filesystem::path& file);
+
+    // (Re)lit un fichier et recalcule ses arêtes sortantes
+    void scan(const std::string& nodeKey);
+    std::string resolveInclude(const std::filesystem::path& from, const std::string& include) const;
+    void unlink(const std::string& nodeKey);
+    void invalidate() const;
+
+    // Rang de chaque nœud dans un ordre topologique stable (tri par clé)
+    const std::unordered_map<std::string, std::size_t>& ranks() const;
+
+    std::unordered_map<std::string, Node> nodes_;
+    std::unordered_map<std::string, std::string> componentsByName_;   // Classe -> clé
+    std::vector<std::filesystem::path> includeDirs_;
+
+    // Calculés à la demande, effacés à chaque modification
+    mutable std::unordered_map<std::string, std::uint64_t> hashes_;
+    mutable std::unordered_map<std::string, std::size_t> ranks_;
+};
+
+} // namespace cppvue::compiler
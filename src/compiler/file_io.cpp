@@ -0,0 +1,133 @@
+#include "file_io.hpp"
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace cppvue::compiler {
+
+namespace {
+    std::atomic<bool> mappingEnabled{true};
+}
+
+void MappedFile::setMappingEnabled(bool enabled) {
+    mappingEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+MappedFile::MappedFile(const std::filesystem::path& path) {
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    struct stat info{};
+    if (fd < 0 || ::fstat(fd, &info) != 0) {
+        std::string error = std::strerror(errno);
+        if (fd >= 0) {
+            ::close(fd);
+        }
+        throw std::runtime_error("Cannot open file: " + path.string() + ": " + error);
+    }
+
+    // Un fichier spécial se lit par read()
+    if (S_ISREG(info.st_mode) && static_cast<std::size_t>(info.st_size) >= MAP_THRESHOLD &&
+        mappingEnabled.load(std::memory_order_relaxed)) {
+        void* data = ::mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED) {
+            data_ = static_cast<const char*>(data);
+            size_ = static_cast<std::size_t>(info.st_size);
+            mapped_ = true;
+            ::close(fd);
+            return;
+        }
+    }
+
+    if (S_ISREG(info.st_mode)) {
+        fallback_.reserve(static_cast<std::size_t>(info.st_size));
+    }
+    char chunk[64 * 1024];
+    for (;;) {
+        ssize_t n = ::read(fd, chunk, sizeof(chunk));
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n < 0) {
+            std::string error = std::strerror(errno);
+            ::close(fd);
+            throw std::runtime_error("Cannot read file: " + path.string() + ": " + error);
+        }
+        if (n == 0) {
+            break;
+        }
+        fallback_.append(chunk, static_cast<std::size_t>(n));
+    }
+    ::close(fd);
+    data_ = fallback_.data();
+    size_ = fallback_.size();
+}
+
+MappedFile::~MappedFile() {
+    if (mapped_) {
+        ::munmap(const_cast<char*>(data_), size_);
+    }
+}
+
+std::string readFile(const std::filesystem::path& path) {
+    MappedFile file(path);
+    return std::string(file.view());
+}
+
+void writeFileAtomic(const std::filesystem::path& path, std::string_view content) {
+    static std::atomic<unsigned> counter{0};
+
+    // Nom temporaire unique par thread et par écriture, dans le même répertoire
+    auto tmpPath = path;
+    tmpPath += ".tmp" + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id())) +
+               "_" + std::to_string(counter.fetch_add(1, std::memory_order_relaxed));
+
+    {
+        std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            throw std::runtime_error("Cannot write file: " + path.string());
+        }
+        file.write(content.data(), static_cast<std::streamsize>(content.size()));
+        if (!file) {
+            std::error_code ignored;
+            std::filesystem::remove(tmpPath, ignored);
+            throw std::runtime_error("Cannot write file: " + path.string());
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tmpPath, path, ec);
+    if (ec) {
+        std::error_code ignored;
+        std::filesystem::remove(tmpPath, ignored);
+        throw std::runtime_error("Cannot replace file: " + path.string() + ": " + ec.message());
+    }
+}
+
+bool writeFileIfChanged(const std::filesystem::path& path, std::string_view content) {
+    // La taille suffit le plus souvent à écarter la lecture du fichier
+    std::error_code ec;
+    auto size = std::filesystem::file_size(path, ec);
+    if (!ec && size == content.size()) {
+        try {
+            MappedFile existing(path);
+            if (existing.view() == content) {
+                return false;
+            }
+        } catch (const std::exception&) {
+            // Illisible : réécrit
+        }
+    }
+    writeFileAtomic(path, content);
+    return true;
+}
+
+} // namespace cppvue::compiler
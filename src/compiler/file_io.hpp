@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace cppvue::compiler {
+
+// Fichier projeté en mémoire (mmap, lecture seule) : le contenu est lu sans
+// copie, valide tant que l'objet existe. std::runtime_error si illisible.
+// Seuls les fichiers d'au moins MAP_THRESHOLD octets sont projetés : en dessous,
+// read() coûte moins que mmap/munmap.
+class MappedFile {
+public:
+    static constexpr std::size_t MAP_THRESHOLD = 256 * 1024;
+
+    explicit MappedFile(const std::filesystem::path& path);
+    ~MappedFile();
+
+    // Les processus de longue durée (--watch, --daemon) désactivent la projection :
+    // un fichier tronqué par un éditeur pendant sa lecture lèverait SIGBUS
+    static void setMappingEnabled(bool enabled);
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    std::string_view view() const { return {data_, size_}; }
+    std::size_t size() const { return size_; }
+
+private:
+    const char* data_ = nullptr;
+    std::size_t size_ = 0;
+    bool mapped_ = false;
+    std::string fallback_;  // Petits fichiers, fichiers spéciaux, projection désactivée
+};
+
+// Lecture complète d'un fichier (std::runtime_error si illisible)
+std::string readFile(const std::filesystem::path& path);
+
+// Écriture atomique : fichier temporaire voisin puis rename, de sorte qu'un
+// lecteur (ou un build interrompu) ne voit jamais un fichier à moitié écrit
+void writeFileAtomic(const std::filesystem::path& path, std::string_view content);
+
+// Écriture atomique seulement si le contenu diffère : un fichier identique
+// garde sa date et le build en aval (CMake, ninja) ne recompile rien.
+// Renvoie true si le fichier a été écrit.
+bool writeFileIfChanged(const std::filesystem::path& path, std::string_view content);
+
+} // namespace cppvue::compiler
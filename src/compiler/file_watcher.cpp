@@ -0,0 +1,283 @@
+#include "file_watcher.hpp"
+#include <algorithm>
+#include <system_error>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <climits>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace cppvue::compiler {
+
+FileWatcher::FileWatcher(std::filesystem::path root, WatchOptions options)
+    : root_(std::move(root)), options_(std::move(options)) {}
+
+FileWatcher::~FileWatcher() {
+    stop();
+}
+
+void FileWatcher::start(Callback onChange) {
+    if (running_) {
+        return;
+    }
+    callback_ = std::move(onChange);
+    running_ = true;
+
+    if (!options_.forcePolling && initInotify()) {
+        thread_ = std::thread(&FileWatcher::runInotify, this);
+    } else {
+        thread_ = std::thread(&FileWatcher::runPolling, this);
+    }
+}
+
+void FileWatcher::stop() {
+    {
+        std::lock_guard<std::mutex> lock(stopMutex_);
+        if (!running_.exchange(false)) {
+            return;
+        }
+    }
+    stopRequested_.notify_all();
+#if defined(__linux__)
+    if (wakePipe_[1] >= 0) {
+        char byte = 0;
+        [[maybe_unused]] auto written = ::write(wakePipe_[1], &byte, 1);
+    }
+#endif
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    closeInotify();
+}
+
+bool FileWatcher::matches(const std::filesystem::path& path) const {
+    auto extension = path.extension();
+    return std::any_of(options_.extensions.begin(), options_.extensions.end(),
+                       [&](const std::string& wanted) { return extension == wanted; });
+}
+
+void FileWatcher::deliver(std::unordered_set<std::string>& pending) {
+    std::vector<std::filesystem::path> changed(pending.begin(), pending.end());
+    pending.clear();
+    std::sort(changed.begin(), changed.end());
+
+    try {
+        callback_(changed);
+    } catch (...) {
+        // Une erreur de l'appelant ne doit pas arrêter la surveillance
+    }
+}
+
+// -- inotify --------------------------------------------------------------
+
+#if defined(__linux__)
+
+namespace {
+    constexpr std::uint32_t WATCH_MASK = IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM |
+                                         IN_CREATE | IN_DELETE | IN_DELETE_SELF | IN_ONLYDIR;
+
+    int remainingMs(std::chrono::steady_clock::time_point deadline) {
+        auto left = std::chrono::ceil<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+        return static_cast<int>(std::max<std::chrono::milliseconds::rep>(left.count(), 0));
+    }
+}
+
+bool FileWatcher::initInotify() {
+    inotifyFd_ = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotifyFd_ < 0) {
+        return false;
+    }
+    if (::pipe2(wakePipe_, O_NONBLOCK | O_CLOEXEC) != 0) {
+        closeInotify();
+        return false;
+    }
+
+    // Le répertoire racine doit être surveillé, sinon on repasse en scrutation
+    std::unordered_set<std::string> ignored;
+    addWatchRecursive(root_, ignored);
+    if (watches_.empty()) {
+        closeInotify();
+        return false;
+    }
+    return true;
+}
+
+void FileWatcher::closeInotify() {
+    for (int* fd : {&inotifyFd_, &wakePipe_[0], &wakePipe_[1]}) {
+        if (*fd >= 0) {
+            ::close(*fd);
+            *fd = -1;
+        }
+    }
+    watches_.clear();
+}
+
+void FileWatcher::addWatchRecursive(const std::filesystem::path& dir, std::unordered_set<std::string>& pending) {
+    int wd = ::inotify_add_watch(inotifyFd_, dir.c_str(), WATCH_MASK);
+    if (wd < 0) {
+        return;
+    }
+    watches_[wd] = dir;
+
+    // Sous-répertoires, et fichiers apparus avant que le watch ne soit posé
+    std::error_code ec;
+    for (std::filesystem::directory_iterator it(dir, ec), end; !ec && it != end; it.increment(ec)) {
+        if (it->is_directory(ec)) {
+            addWatchRecursive(it->path(), pending);
+        } else if (matches(it->path())) {
+            pending.insert(it->path().string());
+        }
+    }
+}
+
+void FileWatcher::runInotify() {
+    using clock = std::chrono::steady_clock;
+
+    // Alignement requis par struct inotify_event
+    alignas(struct inotify_event) char buffer[64 * (sizeof(struct inotify_event) + NAME_MAX + 1)];
+    std::unordered_set<std::string> pending;
+    clock::time_point firstEvent;
+    clock::time_point lastEvent;
+
+    while (running_) {
+        // Sans changement en attente, on dort jusqu'au prochain événement
+        int timeout = -1;
+        if (!pending.empty()) {
+            timeout = std::min(remainingMs(lastEvent + options_.debounce),
+                               remainingMs(firstEvent + options_.maxDelay));
+        }
+
+        pollfd fds[2] = {{inotifyFd_, POLLIN, 0}, {wakePipe_[0], POLLIN, 0}};
+        int ready = ::poll(fds, 2, timeout);
+        if (ready < 0 && errno != EINTR) {
+            break;
+        }
+        if (!running_ || (fds[1].revents & POLLIN)) {
+            break;
+        }
+
+        if (ready > 0 && (fds[0].revents & POLLIN)) {
+            bool wasEmpty = pending.empty();
+            ssize_t length;
+            while ((length = ::read(inotifyFd_, buffer, sizeof(buffer))) > 0) {
+                for (char* p = buffer; p < buffer + length;) {
+                    const auto* event = reinterpret_cast<const struct inotify_event*>(p);
+                    p += sizeof(struct inotify_event) + event->len;
+
+                    if (event->mask & IN_Q_OVERFLOW) {
+                        // Événements perdus : on considère tous les fichiers comme modifiés
+                        for (const auto& [path, stamp] : scan()) {
+                            pending.insert(path);
+                        }
+                        continue;
+                    }
+                    if (event->mask & IN_IGNORED) {
+                        watches_.erase(event->wd);
+                        continue;
+                    }
+
+                    auto dir = watches_.find(event->wd);
+                    if (dir == watches_.end() || event->len == 0) {
+                        continue;
+                    }
+                    auto path = dir->second / event->name;
+
+                    if (event->mask & IN_ISDIR) {
+                        if (event->mask & (IN_CREATE | IN_MOVED_TO)) {
+                            addWatchRecursive(path, pending);
+                        }
+                    } else if (matches(path)) {
+                        pending.insert(path.string());
+                    }
+                }
+            }
+
+            // Tout événement prolonge la rafale en cours
+            if (!pending.empty()) {
+                lastEvent = clock::now();
+                if (wasEmpty) {
+                    firstEvent = lastEvent;
+                }
+            }
+        }
+
+        // Rafale terminée (ou trop longue) : on livre
+        auto now = clock::now();
+        if (!pending.empty() &&
+            (now - lastEvent >= options_.debounce || now - firstEvent >= options_.maxDelay)) {
+            deliver(pending);
+        }
+    }
+}
+
+#else
+
+bool FileWatcher::initInotify() {
+    return false;
+}
+
+void FileWatcher::closeInotify() {}
+
+void FileWatcher::addWatchRecursive(const std::filesystem::path&, std::unordered_set<std::string>&) {}
+
+void FileWatcher::runInotify() {}
+
+#endif
+
+// -- Scrutation -----------------------------------------------------------
+
+FileWatcher::Snapshot FileWatcher::scan() const {
+    Snapshot snapshot;
+    std::error_code ec;
+    for (std::filesystem::recursive_directory_iterator it(root_, ec), end; !ec && it != end; it.increment(ec)) {
+        if (!matches(it->path())) {
+            continue;
+        }
+        std::error_code statError;
+        auto time = it->last_write_time(statError);
+        auto size = it->file_size(statError);
+        if (!statError) {
+            snapshot[it->path().string()] = {time, size};
+        }
+    }
+    return snapshot;
+}
+
+void FileWatcher::runPolling() {
+    Snapshot previous = scan();
+    std::unordered_set<std::string> pending;
+
+    std::unique_lock<std::mutex> lock(stopMutex_);
+    while (running_) {
+        stopRequested_.wait_for(lock, options_.pollInterval, [this]() { return !running_; });
+        if (!running_) {
+            break;
+        }
+        lock.unlock();
+
+        Snapshot current = scan();
+        for (const auto& [path, stamp] : current) {
+            auto it = previous.find(path);
+            if (it == previous.end() || it->second != stamp) {
+                pending.insert(path);
+            }
+        }
+        for (const auto& [path, stamp] : previous) {
+            if (current.count(path) == 0) {
+                pending.insert(path);
+            }
+        }
+        previous = std::move(current);
+
+        if (!pending.empty()) {
+            deliver(pending);
+        }
+        lock.lock();
+    }
+}
+
+} // namespace cppvue::compiler
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace cppvue::compiler {
+
+struct WatchOptions {
+    std::vector<std::string> extensions{".cvue"};  // Seuls ces fichiers sont signalés
+    std::chrono::milliseconds debounce{5};         // Silence attendu avant de livrer une rafale
+    std::chrono::milliseconds maxDelay{100};       // Délai maximal d'une rafale continue
+    std::chrono::milliseconds pollInterval{500};   // Période du mode scrutation
+    bool forcePolling = false;                     // Ignore inotify même sous Linux
+};
+
+// Surveille récursivement un répertoire. Sous Linux les changements arrivent
+// par inotify (aucun coût au repos) ; ailleurs, ou si inotify est indisponible
+// (limite de watches atteinte...), l'arborescence est scrutée périodiquement.
+// Les événements d'une même rafale (sauvegarde d'éditeur : écriture, renommage,
+// suppression du fichier d'échange...) sont regroupés, un chemin par fichier.
+class FileWatcher {
+public:
+    // Chemins modifiés, créés ou supprimés, triés ; appelé sur le thread du watcher
+    using Callback = std::function<void(const std::vector<std::filesystem::path>&)>;
+
+    FileWatcher(std::filesystem::path root, WatchOptions options);
+    ~FileWatcher();
+
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+
+    void start(Callback onChange);
+
+    // Arrête le thread de surveillance ; les changements non livrés sont abandonnés
+    void stop();
+
+    bool usesNativeEvents() const { return inotifyFd_ >= 0; }
+
+private:
+    bool initInotify();
+    void closeInotify();
+    void addWatchRecursive(const std::filesystem::path& dir, std::unordered_set<std::string>& pending);
+    void runInotify();
+
+    using Snapshot = std::unordered_map<std::string, std::pair<std::filesystem::file_time_type, std::uintmax_t>>;
+    Snapshot scan() const;
+    void runPolling();
+
+    bool matches(const std::filesystem::path& path) const;
+    void deliver(std::unordered_set<std::string>& pending);
+
+    std::filesystem::path root_;
+    WatchOptions options_;
+    Callback callback_;
+    std::thread thread_;
+    std::atomic<bool> running_{false};
+
+    // inotify : descripteur, watch -> répertoire, pipe de réveil pour stop()
+    int inotifyFd_ = -1;
+    int wakePipe_[2] = {-1, -1};
+    std::unordered_map<int, std::filesystem::path> watches_;
+
+    // Scrutation
+    std::mutex stopMutex_;
+    std::condition_variable stopRequested_;
+};
+
+} // namespace cppvue::compiler
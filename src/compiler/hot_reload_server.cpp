@@ -0,0 +1,480 @@
+#include "hot_reload_server.hpp"
+#include "file_io.hpp"
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace cppvue::compiler {
+
+namespace {
+    constexpr std::size_t MAX_REQUEST_SIZE = 16 * 1024;
+    constexpr const char* WEBSOCKET_GUID = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+
+    // Client chargé par la page en développement : <script src="http://127.0.0.1:PORT/cppvue-hot.js">.
+    // Le module wasm principal doit être lié avec -sMAIN_MODULE et exporter FS.
+    constexpr const char* CLIENT_SCRIPT = R"JS((() => {
+  const origin = new URL(document.currentScript.src).origin;
+  const socket = new WebSocket(origin.replace(/^http/, 'ws') + '/');
+
+  function applyStyle(component, css) {
+    let style = document.querySelector(`style[data-cppvue-hot="${component}"]`);
+    if (!style) {
+      style = document.createElement('style');
+      style.dataset.cppvueHot = component;
+      document.head.appendChild(style);
+    }
+    style.textContent = css;
+  }
+
+  socket.onmessage = async (event) => {
+    const message = JSON.parse(event.data);
+    if (message.css !== undefined) {
+      applyStyle(message.component, message.css);
+    }
+    if (message.type === 'reload') {
+      location.reload();
+    } else if (message.type === 'render') {
+      try {
+        const response = await fetch(origin + message.module);
+        const bytes = new Uint8Array(await response.arrayBuffer());
+        const path = `/hot/${message.component}.${message.revision}.wasm`;
+        Module.FS.mkdirTree('/hot');
+        Module.FS.writeFile(path, bytes);
+        Module.loadHotModule(path, message.component);
+      } catch (error) {
+        console.error('[cppvue] hot reload failed', error);
+        location.reload();
+      }
+    }
+  };
+})();
+)JS";
+
+    // SHA-1 (FIPS 180-1), uniquement pour le handshake WebSocket
+    std::array<std::uint8_t, 20> sha1(const std::string& input) {
+        std::uint32_t h[5] = {0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0};
+        auto rotl = [](std::uint32_t x, int n) { return (x << n) | (x >> (32 - n)); };
+
+        std::string message = input;
+        std::uint64_t bitLength = static_cast<std::uint64_t>(input.size()) * 8;
+        message += static_cast<char>(0x80);
+        while (message.size() % 64 != 56) {
+            message += '\0';
+        }
+        for (int i = 7; i >= 0; --i) {
+            message += static_cast<char>((bitLength >> (i * 8)) & 0xFF);
+        }
+
+        for (std::size_t chunk = 0; chunk < message.size(); chunk += 64) {
+            std::uint32_t w[80];
+            for (int i = 0; i < 16; ++i) {
+                const auto* p = reinterpret_cast<const unsigned char*>(message.data() + chunk + i * 4);
+                w[i] = (std::uint32_t(p[0]) << 24) | (std::uint32_t(p[1]) << 16) |
+                       (std::uint32_t(p[2]) << 8) | std::uint32_t(p[3]);
+            }
+            for (int i = 16; i < 80; ++i) {
+                w[i] = rotl(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+            }
+
+            std::uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+            for (int i = 0; i < 80; ++i) {
+                std::uint32_t f, k;
+                if (i < 20) {
+                    f = (b & c) | (~b & d);
+                    k = 0x5A827999;
+                } else if (i < 40) {
+                    f = b ^ c ^ d;
+                    k = 0x6ED9EBA1;
+                } else if (i < 60) {
+                    f = (b & c) | (b & d) | (c & d);
+                    k = 0x8F1BBCDC;
+                } else {
+                    f = b ^ c ^ d;
+                    k = 0xCA62C1D6;
+                }
+                std::uint32_t temp = rotl(a, 5) + f + e + k + w[i];
+                e = d;
+                d = c;
+                c = rotl(b, 30);
+                b = a;
+                a = temp;
+            }
+            h[0] += a;
+            h[1] += b;
+            h[2] += c;
+            h[3] += d;
+            h[4] += e;
+        }
+
+        std::array<std::uint8_t, 20> digest;
+        for (int i = 0; i < 20; ++i) {
+            digest[i] = static_cast<std::uint8_t>(h[i / 4] >> (24 - (i % 4) * 8));
+        }
+        return digest;
+    }
+
+    std::string base64(const std::uint8_t* data, std::size_t size) {
+        static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+        std::string result;
+        for (std::size_t i = 0; i < size; i += 3) {
+            std::uint32_t triple = std::uint32_t(data[i]) << 16;
+            if (i + 1 < size) triple |= std::uint32_t(data[i + 1]) << 8;
+            if (i + 2 < size) triple |= std::uint32_t(data[i + 2]);
+            result += alphabet[(triple >> 18) & 0x3F];
+            result += alphabet[(triple >> 12) & 0x3F];
+            result += i + 1 < size ? alphabet[(triple >> 6) & 0x3F] : '=';
+            result += i + 2 < size ? alphabet[triple & 0x3F] : '=';
+        }
+        return result;
+    }
+
+    // Valeur d'un en-tête HTTP (nom insensible à la casse), vide si absent
+    std::string headerValue(const std::string& request, const std::string& name) {
+        std::size_t pos = request.find("\r\n");
+        while (pos != std::string::npos && pos + 2 < request.size()) {
+            std::size_t lineStart = pos + 2;
+            std::size_t lineEnd = request.find("\r\n", lineStart);
+            if (lineEnd == std::string::npos || lineEnd == lineStart) {
+                break;
+            }
+            std::size_t colon = request.find(':', lineStart);
+            if (colon != std::string::npos && colon < lineEnd && colon - lineStart == name.size() &&
+                std::equal(name.begin(), name.end(), request.begin() + lineStart, [](char a, char b) {
+                    return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
+                })) {
+                std::size_t valueStart = request.find_first_not_of(" \t", colon + 1);
+                std::size_t valueEnd = request.find_last_not_of(" \t", lineEnd - 1);
+                return valueStart <= valueEnd ? request.substr(valueStart, valueEnd - valueStart + 1) : "";
+            }
+            pos = lineEnd;
+        }
+        return {};
+    }
+
+    bool containsToken(std::string value, const std::string& token) {
+        std::transform(value.begin(), value.end(), value.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return value.find(token) != std::string::npos;
+    }
+
+    bool sendAll(int fd, const std::string& data) {
+        std::size_t sent = 0;
+        while (sent < data.size()) {
+            ssize_t n = ::send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            if (n <= 0) {
+                return false;
+            }
+            sent += static_cast<std::size_t>(n);
+        }
+        return true;
+    }
+
+    // Trame serveur (jamais masquée)
+    std::string frame(std::uint8_t opcode, const std::string& payload) {
+        std::string result;
+        result += static_cast<char>(0x80 | opcode);
+        if (payload.size() < 126) {
+            result += static_cast<char>(payload.size());
+        } else if (payload.size() <= 0xFFFF) {
+            result += static_cast<char>(126);
+            result += static_cast<char>((payload.size() >> 8) & 0xFF);
+            result += static_cast<char>(payload.size() & 0xFF);
+        } else {
+            result += static_cast<char>(127);
+            for (int i = 7; i >= 0; --i) {
+                result += static_cast<char>((static_cast<std::uint64_t>(payload.size()) >> (i * 8)) & 0xFF);
+            }
+        }
+        return result + payload;
+    }
+
+    void sendResponse(int fd, const std::string& status, const std::string& contentType, const std::string& body) {
+        std::string response = "HTTP/1.1 " + status + "\r\n";
+        response += "Content-Type: " + contentType + "\r\n";
+        response += "Content-Length: " + std::to_string(body.size()) + "\r\n";
+        response += "Access-Control-Allow-Origin: *\r\n";
+        response += "Cache-Control: no-store\r\n";
+        response += "Connection: close\r\n\r\n";
+        sendAll(fd, response + body);
+    }
+}
+
+HotReloadServer::HotReloadServer(std::uint16_t port, std::filesystem::path root)
+    : port_(port), root_(std::move(root)) {}
+
+HotReloadServer::~HotReloadServer() {
+    stop();
+}
+
+std::string HotReloadServer::websocketAccept(const std::string& key) {
+    auto digest = sha1(key + WEBSOCKET_GUID);
+    return base64(digest.data(), digest.size());
+}
+
+void HotReloadServer::start() {
+    if (running_) {
+        return;
+    }
+
+    listenFd_ = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (listenFd_ < 0) {
+        throw std::runtime_error(std::string("Hot reload server: socket: ") + std::strerror(errno));
+    }
+    int reuse = 1;
+    ::setsockopt(listenFd_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    // Boucle locale uniquement : le serveur sert des fichiers du répertoire de build
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(port_);
+    if (::bind(listenFd_, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        ::listen(listenFd_, 16) != 0 || ::pipe2(wakePipe_, O_NONBLOCK | O_CLOEXEC) != 0) {
+        std::string error = std::strerror(errno);
+        stop();
+        throw std::runtime_error("Hot reload server: cannot listen on 127.0.0.1:" +
+                                 std::to_string(port_) + ": " + error);
+    }
+
+    socklen_t length = sizeof(address);
+    ::getsockname(listenFd_, reinterpret_cast<sockaddr*>(&address), &length);
+    port_ = ntohs(address.sin_port);
+
+    running_ = true;
+    thread_ = std::thread(&HotReloadServer::run, this);
+}
+
+void HotReloadServer::stop() {
+    if (running_.exchange(false) && wakePipe_[1] >= 0) {
+        char byte = 0;
+        [[maybe_unused]] auto written = ::write(wakePipe_[1], &byte, 1);
+    }
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+
+    for (auto& connection : connections_) {
+        close(connection);
+    }
+    connections_.clear();
+    for (int* fd : {&listenFd_, &wakePipe_[0], &wakePipe_[1]}) {
+        if (*fd >= 0) {
+            ::close(*fd);
+            *fd = -1;
+        }
+    }
+}
+
+std::size_t HotReloadServer::clientCount() const {
+    std::lock_guard<std::mutex> lock(socketsMutex_);
+    return sockets_.size();
+}
+
+void HotReloadServer::broadcast(const std::string& message) {
+    std::string data = frame(0x1, message);
+    std::lock_guard<std::mutex> lock(socketsMutex_);
+    for (int fd : sockets_) {
+        // Une page fermée entre-temps est retirée par le thread du serveur
+        sendAll(fd, data);
+    }
+}
+
+void HotReloadServer::run() {
+    std::vector<pollfd> fds;
+    while (running_) {
+        fds.clear();
+        fds.push_back({wakePipe_[0], POLLIN, 0});
+        fds.push_back({listenFd_, POLLIN, 0});
+        for (const auto& connection : connections_) {
+            fds.push_back({connection.fd, POLLIN, 0});
+        }
+
+        if (::poll(fds.data(), fds.size(), -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        if (fds[0].revents) {
+            break;
+        }
+
+        // Les connexions ajoutées par accept() ne sont pas encore dans fds
+        std::size_t polled = connections_.size();
+        for (std::size_t i = 0; i < polled; ++i) {
+            if (!fds[i + 2].revents) {
+                continue;
+            }
+            auto& connection = connections_[i];
+            bool keep = connection.websocket ? handleFrames(connection) : handleRequest(connection);
+            if (!keep) {
+                close(connection);
+            }
+        }
+        connections_.erase(std::remove_if(connections_.begin(), connections_.end(),
+                                          [](const Connection& c) { return c.fd < 0; }),
+                           connections_.end());
+
+        if (fds[1].revents & POLLIN) {
+            accept();
+        }
+    }
+}
+
+void HotReloadServer::accept() {
+    int fd = ::accept4(listenFd_, nullptr, nullptr, SOCK_CLOEXEC);
+    if (fd >= 0) {
+        connections_.push_back({fd, {}, false});
+    }
+}
+
+bool HotReloadServer::handleRequest(Connection& connection) {
+    char chunk[4096];
+    ssize_t n = ::recv(connection.fd, chunk, sizeof(chunk), 0);
+    if (n <= 0) {
+        return false;
+    }
+    connection.buffer.append(chunk, static_cast<std::size_t>(n));
+
+    std::size_t headerEnd = connection.buffer.find("\r\n\r\n");
+    if (headerEnd == std::string::npos) {
+        return connection.buffer.size() < MAX_REQUEST_SIZE;
+    }
+    std::string request = connection.buffer.substr(0, headerEnd + 2);
+    connection.buffer.clear();
+
+    // Ligne de requête : GET <chemin> HTTP/1.1
+    std::size_t methodEnd = request.find(' ');
+    std::size_t pathEnd = methodEnd == std::string::npos ? std::string::npos : request.find(' ', methodEnd + 1);
+    if (pathEnd == std::string::npos || request.compare(0, methodEnd, "GET") != 0) {
+        sendResponse(connection.fd, "405 Method Not Allowed", "text/plain", "GET only\n");
+        return false;
+    }
+    std::string path = request.substr(methodEnd + 1, pathEnd - methodEnd - 1);
+
+    std::string key = headerValue(request, "Sec-WebSocket-Key");
+    if (!key.empty() && containsToken(headerValue(request, "Upgrade"), "websocket")) {
+        std::string response = "HTTP/1.1 101 Switching Protocols\r\n"
+                               "Upgrade: websocket\r\n"
+                               "Connection: Upgrade\r\n"
+                               "Sec-WebSocket-Accept: " + websocketAccept(key) + "\r\n\r\n";
+        if (!sendAll(connection.fd, response)) {
+            return false;
+        }
+        connection.websocket = true;
+        std::lock_guard<std::mutex> lock(socketsMutex_);
+        sockets_.push_back(connection.fd);
+        return true;
+    }
+
+    serveFile(connection.fd, path);
+    return false;
+}
+
+void HotReloadServer::serveFile(int fd, const std::string& path) {
+    std::string file = path.substr(0, path.find('?'));
+    if (file == "/cppvue-hot.js") {
+        sendResponse(fd, "200 OK", "text/javascript", CLIENT_SCRIPT);
+        return;
+    }
+
+    // /hot/<nom>.wasm, sans sortie du répertoire
+    std::string name = file.rfind("/hot/", 0) == 0 ? file.substr(5) : "";
+    bool valid = name.size() > 5 && name.compare(name.size() - 5, 5, ".wasm") == 0 &&
+                 std::all_of(name.begin(), name.end(), [](unsigned char c) {
+                     return std::isalnum(c) || c == '_' || c == '-' || c == '.';
+                 }) && name.find("..") == std::string::npos;
+    if (valid) {
+        try {
+            sendResponse(fd, "200 OK", "application/wasm", readFile(root_ / "hot" / name));
+            return;
+        } catch (const std::exception&) {
+            // Module pas (encore) produit
+        }
+    }
+    sendResponse(fd, "404 Not Found", "text/plain", "Not found\n");
+}
+
+bool HotReloadServer::handleFrames(Connection& connection) {
+    char chunk[4096];
+    ssize_t n = ::recv(connection.fd, chunk, sizeof(chunk), 0);
+    if (n <= 0) {
+        return false;
+    }
+    connection.buffer.append(chunk, static_cast<std::size_t>(n));
+
+    // Les pages n'envoient que des ping et la fermeture ; le reste est ignoré
+    auto& buffer = connection.buffer;
+    while (buffer.size() >= 2) {
+        auto byte = [&](std::size_t i) { return static_cast<std::uint8_t>(buffer[i]); };
+        std::uint8_t opcode = byte(0) & 0x0F;
+        bool masked = byte(1) & 0x80;
+        std::uint64_t length = byte(1) & 0x7F;
+        std::size_t offset = 2;
+        if (length == 126) {
+            if (buffer.size() < 4) break;
+            length = (std::uint64_t(byte(2)) << 8) | byte(3);
+            offset = 4;
+        } else if (length == 127) {
+            if (buffer.size() < 10) break;
+            length = 0;
+            for (int i = 0; i < 8; ++i) {
+                length = (length << 8) | byte(2 + i);
+            }
+            offset = 10;
+        }
+        if (length > MAX_REQUEST_SIZE) {
+            return false;
+        }
+        std::size_t maskOffset = offset;
+        offset += masked ? 4 : 0;
+        if (buffer.size() < offset + length) {
+            break;
+        }
+
+        std::string payload = buffer.substr(offset, length);
+        if (masked) {
+            for (std::size_t i = 0; i < payload.size(); ++i) {
+                payload[i] = static_cast<char>(payload[i] ^ buffer[maskOffset + i % 4]);
+            }
+        }
+        buffer.erase(0, offset + length);
+
+        if (opcode == 0x8) {
+            std::lock_guard<std::mutex> lock(socketsMutex_);
+            sendAll(connection.fd, frame(0x8, payload.substr(0, 2)));
+            return false;
+        }
+        if (opcode == 0x9) {
+            std::lock_guard<std::mutex> lock(socketsMutex_);
+            sendAll(connection.fd, frame(0xA, payload));
+        }
+    }
+    return true;
+}
+
+void HotReloadServer::close(Connection& connection) {
+    if (connection.fd < 0) {
+        return;
+    }
+    // Retirée de sockets_ avant la fermeture : broadcast() n'écrit jamais dans un fd recyclé
+    std::lock_guard<std::mutex> lock(socketsMutex_);
+    sockets_.erase(std::remove(sockets_.begin(), sockets_.end(), connection.fd), sockets_.end());
+    ::close(connection.fd);
+    connection.fd = -1;
+}
+
+} // namespace cppvue::compiler
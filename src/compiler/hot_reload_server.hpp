@@ -0,0 +1,68 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace cppvue::compiler {
+
+// Serveur de développement du hot reload, sur 127.0.0.1 uniquement.
+// Les pages connectées en WebSocket (RFC 6455) reçoivent les messages JSON de
+// broadcast() ; les autres requêtes GET servent le client JavaScript
+// (/cppvue-hot.js) et les modules recompilés (/hot/<Composant>.wasm) lus dans root.
+class HotReloadServer {
+public:
+    HotReloadServer(std::uint16_t port, std::filesystem::path root);
+    ~HotReloadServer();
+
+    HotReloadServer(const HotReloadServer&) = delete;
+    HotReloadServer& operator=(const HotReloadServer&) = delete;
+
+    // Ouvre le port et démarre le thread du serveur ; std::runtime_error si le
+    // port est pris. Un port 0 est choisi par le système (voir port())
+    void start();
+    void stop();
+
+    std::uint16_t port() const { return port_; }
+    std::size_t clientCount() const;
+
+    // Envoie un message texte à toutes les pages connectées
+    void broadcast(const std::string& message);
+
+    // Valeur de Sec-WebSocket-Accept pour une clé de handshake
+    static std::string websocketAccept(const std::string& key);
+
+private:
+    struct Connection {
+        int fd = -1;
+        std::string buffer;
+        bool websocket = false;
+    };
+
+    void run();
+    void accept();
+
+    // false quand la connexion doit être fermée
+    bool handleRequest(Connection& connection);
+    bool handleFrames(Connection& connection);
+    void serveFile(int fd, const std::string& path);
+    void close(Connection& connection);
+
+    std::uint16_t port_;
+    std::filesystem::path root_;
+    int listenFd_ = -1;
+    int wakePipe_[2] = {-1, -1};
+    std::thread thread_;
+    std::atomic<bool> running_{false};
+
+    // Pages connectées ; écrites par broadcast() depuis le thread du watcher
+    mutable std::mutex socketsMutex_;
+    std::vector<int> sockets_;
+    std::vector<Connection> connections_;  // Thread du serveur uniquement
+};
+
+} // namespace cppvue::compiler
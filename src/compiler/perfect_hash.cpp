@@ -0,0 +1,91 @@
+#include "perfect_hash.hpp"
+#include "../core/component_table.hpp"
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <unordered_set>
+
+namespace cppvue::compiler {
+
+namespace {
+    // Au-delà, les clés ne sont pas hachables séparément (ne se produit pas avec des clés distinctes)
+    constexpr std::int32_t MAX_SEED = 1 << 24;
+}
+
+PerfectHash PerfectHashBuilder::build(const std::vector<std::string>& keys) {
+    auto n = static_cast<std::uint32_t>(keys.size());
+    PerfectHash result{std::vector<std::int32_t>(n, 0), std::vector<std::uint32_t>(n, 0)};
+    if (n == 0) {
+        return result;
+    }
+
+    std::unordered_set<std::string> distinct(keys.begin(), keys.end());
+    if (distinct.size() != keys.size()) {
+        throw std::runtime_error("Perfect hash: duplicate key");
+    }
+
+    std::vector<std::vector<std::uint32_t>> buckets(n);
+    for (std::uint32_t i = 0; i < n; ++i) {
+        buckets[ComponentTable::hash(keys[i], 0) % n].push_back(i);
+    }
+
+    // Les seaux les plus remplis d'abord, tant que la table est vide
+    std::vector<std::uint32_t> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](std::uint32_t a, std::uint32_t b) {
+        return buckets[a].size() > buckets[b].size();
+    });
+
+    std::vector<bool> used(n, false);
+    std::vector<std::uint32_t> candidate;
+    for (auto b : order) {
+        const auto& bucket = buckets[b];
+        if (bucket.size() < 2) {
+            break;
+        }
+
+        // Première graine qui envoie toutes les clés du seau dans des cases libres
+        for (std::int32_t seed = 1;; ++seed) {
+            if (seed == MAX_SEED) {
+                throw std::runtime_error("Perfect hash: no seed found");
+            }
+            candidate.clear();
+            bool fits = true;
+            for (auto key : bucket) {
+                auto slot = static_cast<std::uint32_t>(
+                    ComponentTable::hash(keys[key], static_cast<std::uint64_t>(seed)) % n);
+                if (used[slot] || std::find(candidate.begin(), candidate.end(), slot) != candidate.end()) {
+                    fits = false;
+                    break;
+                }
+                candidate.push_back(slot);
+            }
+            if (fits) {
+                for (std::size_t i = 0; i < bucket.size(); ++i) {
+                    used[candidate[i]] = true;
+                    result.slots[candidate[i]] = bucket[i];
+                }
+                result.displacements[b] = seed;
+                break;
+            }
+        }
+    }
+
+    // Seaux d'une seule clé : case libre désignée directement
+    std::uint32_t freeSlot = 0;
+    for (auto b : order) {
+        if (buckets[b].size() != 1) {
+            continue;
+        }
+        while (used[freeSlot]) {
+            ++freeSlot;
+        }
+        used[freeSlot] = true;
+        result.slots[freeSlot] = buckets[b][0];
+        result.displacements[b] = -static_cast<std::int32_t>(freeSlot) - 1;
+    }
+
+    return result;
+}
+
+} // namespace cppvue::compiler
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace cppvue::compiler {
+
+// Hachage parfait minimal (hash and displace) : n clés dans n cases, une
+// graine par seau. La recherche correspondante est ComponentTable::idOf.
+struct PerfectHash {
+    std::vector<std::int32_t> displacements;  // Par seau (hash(clé, 0) % n)
+    std::vector<std::uint32_t> slots;         // Case -> indice de la clé
+};
+
+class PerfectHashBuilder {
+public:
+    // Clés distinctes ; std::runtime_error si aucune graine ne convient
+    static PerfectHash build(const std::vector<std::string>& keys);
+};
+
+} // namespace cppvue::compiler
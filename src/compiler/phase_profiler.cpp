@@ -0,0 +1,215 @@
+#include "phase_profiler.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <unordered_map>
+#include <sys/resource.h>
+
+namespace cppvue::compiler {
+
+namespace {
+    // Fichier du scope englobant, sur chaque thread
+    thread_local std::string currentFile;
+
+    long maxRssKb() {
+        rusage usage{};
+        getrusage(RUSAGE_SELF, &usage);
+        return usage.ru_maxrss;
+    }
+
+    // Échappe une chaîne pour l'export JSON
+    void writeJsonString(std::ostream& out, const std::string& str) {
+        out << '"';
+        for (char c : str) {
+            switch (c) {
+                case '"': out << "\\\""; break;
+                case '\\': out << "\\\\"; break;
+                case '\n': out << "\\n"; break;
+                case '\t': out << "\\t"; break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20) {
+                        out << ' ';
+                    } else {
+                        out << c;
+                    }
+            }
+        }
+        out << '"';
+    }
+
+    std::string milliseconds(std::uint64_t nanoseconds) {
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%.2f", static_cast<double>(nanoseconds) / 1e6);
+        return buffer;
+    }
+
+    // Span englobant d'un composant, exclu des totaux par phase
+    constexpr const char* COMPONENT_PHASE = "component";
+}
+
+void PhaseProfiler::clear() {
+    std::lock_guard<std::mutex> lock(spansMutex_);
+    spans_.clear();
+}
+
+void PhaseProfiler::record(PhaseSpan span) {
+    std::lock_guard<std::mutex> lock(spansMutex_);
+    spans_.push_back(std::move(span));
+}
+
+std::uint64_t PhaseProfiler::now() const {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - origin_).count();
+}
+
+std::uint32_t PhaseProfiler::threadId() {
+    static std::atomic<std::uint32_t> nextId{1};
+    thread_local std::uint32_t id = nextId.fetch_add(1, std::memory_order_relaxed);
+    return id;
+}
+
+std::string PhaseProfiler::exportChromeTrace() const {
+    std::ostringstream out;
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    std::lock_guard<std::mutex> lock(spansMutex_);
+    bool first = true;
+    for (const auto& span : spans_) {
+        if (!first) out << ",";
+        first = false;
+
+        // Événements complets (X) : début et durée en microsecondes
+        out << "{\"name\":";
+        writeJsonString(out, span.phase);
+        out << ",\"cat\":\"cvue\",\"ph\":\"X\"";
+        out << ",\"ts\":" << span.start / 1000 << "." << span.start % 1000 / 100;
+        out << ",\"dur\":" << span.duration / 1000 << "." << span.duration % 1000 / 100;
+        out << ",\"pid\":1,\"tid\":" << span.threadId;
+        out << ",\"args\":{";
+        if (!span.file.empty()) {
+            out << "\"file\":";
+            writeJsonString(out, span.file);
+            out << ",";
+        }
+        out << "\"maxRssKb\":" << span.maxRssKb << "}}";
+    }
+
+    out << "]}";
+    return out.str();
+}
+
+bool PhaseProfiler::writeChromeTrace(const std::filesystem::path& path) const {
+    std::ofstream file(path);
+    if (!file) {
+        return false;
+    }
+    file << exportChromeTrace();
+    return static_cast<bool>(file);
+}
+
+std::string PhaseProfiler::summary(std::size_t topN) const {
+    struct PhaseTotal {
+        std::uint64_t nanoseconds = 0;
+        std::size_t count = 0;
+    };
+    struct ComponentTotal {
+        std::uint64_t nanoseconds = 0;
+        std::map<std::string, std::uint64_t> phases;
+    };
+
+    std::map<std::string, PhaseTotal> phases;
+    std::unordered_map<std::string, ComponentTotal> components;
+    std::uint64_t phaseSum = 0;
+    std::uint64_t wallEnd = 0;
+    long peakRss = 0;
+    {
+        std::lock_guard<std::mutex> lock(spansMutex_);
+        for (const auto& span : spans_) {
+            wallEnd = std::max(wallEnd, span.start + span.duration);
+            peakRss = std::max(peakRss, span.maxRssKb);
+            if (std::string(span.phase) == COMPONENT_PHASE) {
+                components[span.file].nanoseconds += span.duration;
+                continue;
+            }
+            auto& total = phases[span.phase];
+            total.nanoseconds += span.duration;
+            total.count++;
+            phaseSum += span.duration;
+            if (!span.file.empty()) {
+                components[span.file].phases[span.phase] += span.duration;
+            }
+        }
+    }
+
+    std::ostringstream out;
+    out << "time trace: " << milliseconds(wallEnd) << " ms traced, peak RSS " << peakRss / 1024 << " MiB\n";
+
+    // Phases : temps cumulé sur tous les threads
+    std::vector<std::pair<std::string, PhaseTotal>> byPhase(phases.begin(), phases.end());
+    std::sort(byPhase.begin(), byPhase.end(),
+              [](const auto& a, const auto& b) { return a.second.nanoseconds > b.second.nanoseconds; });
+    for (const auto& [phase, total] : byPhase) {
+        char line[128];
+        std::snprintf(line, sizeof(line), "  %-14s %10s ms %6.1f%% %7zu spans\n", phase.c_str(),
+                      milliseconds(total.nanoseconds).c_str(),
+                      phaseSum ? 100.0 * static_cast<double>(total.nanoseconds) / static_cast<double>(phaseSum) : 0.0,
+                      total.count);
+        out << line;
+    }
+
+    std::vector<std::pair<std::string, ComponentTotal>> byComponent;
+    for (auto& [file, total] : components) {
+        if (total.nanoseconds > 0) {
+            byComponent.emplace_back(file, std::move(total));
+        }
+    }
+    std::sort(byComponent.begin(), byComponent.end(),
+              [](const auto& a, const auto& b) { return a.second.nanoseconds > b.second.nanoseconds; });
+    if (byComponent.size() > topN) {
+        byComponent.resize(topN);
+    }
+    if (!byComponent.empty()) {
+        out << "slowest components:\n";
+    }
+    for (const auto& [file, total] : byComponent) {
+        out << "  " << milliseconds(total.nanoseconds) << " ms  " << file;
+        std::string separator = "  (";
+        for (const auto& [phase, nanoseconds] : total.phases) {
+            out << separator << phase << " " << milliseconds(nanoseconds);
+            separator = ", ";
+        }
+        out << (total.phases.empty() ? "" : ")") << "\n";
+    }
+    return out.str();
+}
+
+PhaseScope::PhaseScope(const char* phase, const std::filesystem::path& file)
+    : phase_(phase) {
+    auto& profiler = PhaseProfiler::instance();
+    active_ = profiler.enabled();
+    if (!active_) {
+        return;
+    }
+    if (!file.empty()) {
+        previousFile_ = std::move(currentFile);
+        currentFile = file.generic_string();
+        ownsFile_ = true;
+    }
+    start_ = profiler.now();
+}
+
+PhaseScope::~PhaseScope() {
+    if (!active_) {
+        return;
+    }
+    auto& profiler = PhaseProfiler::instance();
+    auto end = profiler.now();
+    profiler.record({phase_, currentFile, start_, end - start_, PhaseProfiler::threadId(), maxRssKb()});
+    if (ownsFile_) {
+        currentFile = std::move(previousFile_);
+    }
+}
+
+} // namespace cppvue::compiler
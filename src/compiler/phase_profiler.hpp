@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace cppvue::compiler {
+
+// Span d'une phase de compilation
+struct PhaseSpan {
+    const char* phase;         // Littéral statique ("read", "template"...)
+    std::string file;          // Composant concerné, vide pour les phases globales
+    std::uint64_t start;       // Nanosecondes depuis le démarrage du profiler
+    std::uint64_t duration;
+    std::uint32_t threadId;
+    long maxRssKb;             // Pic de mémoire résidente du processus à la fin du span
+};
+
+// Profil des phases du compilateur (cvuec --time-trace) : spans par fichier et
+// par phase, exportés au format Chrome Trace Event (Perfetto, chrome://tracing)
+// avec un résumé des composants et des phases les plus coûteux.
+// Inactif par défaut : un PhaseScope ne coûte alors qu'un test.
+class PhaseProfiler {
+public:
+    static PhaseProfiler& instance() {
+        static PhaseProfiler profiler;
+        return profiler;
+    }
+
+    void start() { enabled_.store(true, std::memory_order_relaxed); }
+    void stop() { enabled_.store(false, std::memory_order_relaxed); }
+    bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+    void clear();
+
+    void record(PhaseSpan span);
+    std::uint64_t now() const;
+
+    std::string exportChromeTrace() const;
+    bool writeChromeTrace(const std::filesystem::path& path) const;
+
+    // Temps total par phase, puis les topN composants les plus lents
+    std::string summary(std::size_t topN) const;
+
+    static std::uint32_t threadId();
+
+private:
+    PhaseProfiler() : origin_(std::chrono::steady_clock::now()) {}
+
+    std::atomic<bool> enabled_{false};
+    std::chrono::steady_clock::time_point origin_;
+
+    // Quelques spans par fichier : un verrou suffit
+    mutable std::mutex spansMutex_;
+    std::vector<PhaseSpan> spans_;
+};
+
+// Span RAII. Un scope avec un fichier le rend courant sur le thread : les
+// scopes imbriqués sans fichier (parsing, génération...) lui sont rattachés.
+class PhaseScope {
+public:
+    explicit PhaseScope(const char* phase, const std::filesystem::path& file = {});
+    ~PhaseScope();
+
+    PhaseScope(const PhaseScope&) = delete;
+    PhaseScope& operator=(const PhaseScope&) = delete;
+
+private:
+    const char* phase_;
+    std::string previousFile_;
+    std::uint64_t start_ = 0;
+    bool active_ = false;
+    bool ownsFile_ = false;
+};
+
+} // namespace cppvue::compiler
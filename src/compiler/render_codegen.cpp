@@ -0,0 +1,956 @@
+#include "render_codegen.hpp"
+#include "build_cache.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <iterator>
+
+namespace cppvue::compiler {
+
+namespace {
+    // Token d'une expression de template
+    struct ExprToken {
+        enum class Kind { IDENTIFIER, NUMBER, STRING, PUNCT };
+        Kind kind;
+        std::string text;
+    };
+
+    using Tokens = std::vector<ExprToken>;
+
+    std::string formatLocation(const TemplateNode& node) {
+        return std::to_string(node.location.line) + ":" +
+               std::to_string(node.location.column) + ": ";
+    }
+
+    bool isIdentifierStart(char c) {
+        return std::isalpha(static_cast<unsigned char>(c)) || c == '_' || c == '$';
+    }
+
+    bool isIdentifierChar(char c) {
+        return isIdentifierStart(c) || std::isdigit(static_cast<unsigned char>(c));
+    }
+
+    // Littéral chaîne C++ (échappements minimaux, UTF-8 conservé tel quel)
+    std::string cppLiteral(std::string_view value) {
+        std::string out = "\"";
+        for (char c : value) {
+            switch (c) {
+                case '"': out += "\\\""; break;
+                case '\\': out += "\\\\"; break;
+                case '\n': out += "\\n"; break;
+                case '\r': out += "\\r"; break;
+                case '\t': out += "\\t"; break;
+                default: out += c;
+            }
+        }
+        return out + "\"";
+    }
+
+    Tokens lexExpression(std::string_view source) {
+        static const char* const operators[] = {
+            "===", "!==", "=>", "==", "!=", "<=", ">=", "&&", "||",
+            "++", "--", "+=", "-=", "*=", "/=", "?."
+        };
+
+        Tokens tokens;
+        std::size_t i = 0;
+        while (i < source.size()) {
+            char c = source[i];
+            if (std::isspace(static_cast<unsigned char>(c))) {
+                ++i;
+            } else if (isIdentifierStart(c)) {
+                std::size_t start = i;
+                while (i < source.size() && isIdentifierChar(source[i])) ++i;
+                tokens.push_back({ExprToken::Kind::IDENTIFIER, std::string(source.substr(start, i - start))});
+            } else if (std::isdigit(static_cast<unsigned char>(c))) {
+                std::size_t start = i;
+                while (i < source.size() && (std::isalnum(static_cast<unsigned char>(source[i])) ||
+                                             source[i] == '.')) ++i;
+                tokens.push_back({ExprToken::Kind::NUMBER, std::string(source.substr(start, i - start))});
+            } else if (c == '\'' || c == '"') {
+                std::string value;
+                ++i;
+                while (i < source.size() && source[i] != c) {
+                    if (source[i] == '\\' && i + 1 < source.size()) {
+                        ++i;
+                    }
+                    value += source[i++];
+                }
+                if (i >= source.size()) {
+                    throw TemplateParseError("Unterminated string in expression: " + std::string(source));
+                }
+                ++i;
+                tokens.push_back({ExprToken::Kind::STRING, value});
+            } else if (c == '`') {
+                throw TemplateParseError("Template literals are not supported: " + std::string(source));
+            } else {
+                std::string op(1, c);
+                for (const char* candidate : operators) {
+                    if (source.compare(i, std::strlen(candidate), candidate) == 0) {
+                        op = candidate;
+                        break;
+                    }
+                }
+                i += op.size();
+                tokens.push_back({ExprToken::Kind::PUNCT, op});
+            }
+        }
+        return tokens;
+    }
+
+    bool isPunct(const Tokens& tokens, std::size_t i, const char* text) {
+        return i < tokens.size() && tokens[i].kind == ExprToken::Kind::PUNCT && tokens[i].text == text;
+    }
+
+    // Index du premier token ponctuation `text` hors parenthèses/crochets/accolades
+    std::size_t findTopLevel(const Tokens& tokens, std::size_t begin, std::size_t end, const char* text) {
+        int depth = 0;
+        for (std::size_t i = begin; i < end; ++i) {
+            if (tokens[i].kind != ExprToken::Kind::PUNCT) continue;
+            const auto& t = tokens[i].text;
+            if (t == "(" || t == "[" || t == "{") {
+                ++depth;
+            } else if (t == ")" || t == "]" || t == "}") {
+                --depth;
+            } else if (depth == 0 && t == text) {
+                return i;
+            }
+        }
+        return end;
+    }
+
+    bool isBinaryOperator(const std::string& op) {
+        static const char* const binary[] = {
+            "==", "!=", "<", ">", "<=", ">=", "&&", "||", "+", "-", "*", "/", "%",
+            "?", ":", "=", "+=", "-=", "*=", "/="
+        };
+        return std::any_of(std::begin(binary), std::end(binary),
+                           [&](const char* candidate) { return op == candidate; });
+    }
+
+    // Membres publics de cppvue::Component utilisables depuis un template
+    bool isComponentApi(const std::string& name) {
+        return name == "emit" || name == "getProp" || name == "getRef" || name == "setRef";
+    }
+
+    // Nom libre (ni local ni littéral) : prop -> accesseur, membre -> unref() ou appel direct
+    std::string resolveIdentifier(const ComponentSymbols& symbols, const std::string& name, bool call) {
+        if (symbols.props.count(name) > 0) {
+            return call ? name : name + "()";
+        }
+        if (symbols.known && symbols.members.count(name) == 0 && !(call && isComponentApi(name))) {
+            throw TemplateParseError("Unknown identifier in template expression: " + name +
+                                     " (not a member or CPPVUE_PROP of the component)");
+        }
+        return call ? name : "unref(" + name + ")";
+    }
+
+    // Cible d'assign() : un membre du composant (les props sont en lecture seule)
+    const std::string& assignmentTarget(const ComponentSymbols& symbols, const std::string& name) {
+        if (symbols.props.count(name) > 0) {
+            throw TemplateParseError("Cannot assign to prop: " + name);
+        }
+        resolveIdentifier(symbols, name, false);
+        return name;
+    }
+
+    // Traduit tokens[begin, end) ; les identifiants libres sont résolus sur le composant
+    std::string translateTokens(const Tokens& tokens, std::size_t begin, std::size_t end,
+                                const std::vector<std::string>& locals, const ComponentSymbols& symbols) {
+        std::string out;
+        bool previousIsOperand = false;
+
+        for (std::size_t i = begin; i < end; ++i) {
+            const auto& token = tokens[i];
+            bool afterDot = i > begin && (isPunct(tokens, i - 1, ".") || isPunct(tokens, i - 1, "?."));
+            bool beforeCall = isPunct(tokens, i + 1, "(");
+
+            switch (token.kind) {
+                case ExprToken::Kind::IDENTIFIER:
+                    if (afterDot) {
+                        out += token.text == "length" && !beforeCall ? "size()" : token.text;
+                    } else if (token.text == "$event") {
+                        out += "cppvue_event";
+                    } else if (token.text == "null" || token.text == "undefined") {
+                        out += "nullptr";
+                    } else if (token.text == "true" || token.text == "false" || token.text == "this" ||
+                               std::find(locals.begin(), locals.end(), token.text) != locals.end()) {
+                        out += token.text;
+                    } else {
+                        out += resolveIdentifier(symbols, token.text, beforeCall);
+                    }
+                    previousIsOperand = true;
+                    break;
+
+                case ExprToken::Kind::NUMBER:
+                    out += token.text;
+                    previousIsOperand = true;
+                    break;
+
+                case ExprToken::Kind::STRING:
+                    out += "std::string(" + cppLiteral(token.text) + ")";
+                    previousIsOperand = true;
+                    break;
+
+                case ExprToken::Kind::PUNCT: {
+                    std::string op = token.text == "===" ? "==" :
+                                     token.text == "!==" ? "!=" :
+                                     token.text == "?." ? "." : token.text;
+                    if (op == ",") {
+                        out += ", ";
+                    } else if (isBinaryOperator(op) && (previousIsOperand || (op != "-" && op != "+"))) {
+                        out += " " + op + " ";
+                    } else {
+                        out += op;
+                    }
+                    previousIsOperand = op == ")" || op == "]";
+                    break;
+                }
+            }
+        }
+        return out;
+    }
+
+    std::string trimCopy(std::string_view str) {
+        auto begin = str.find_first_not_of(" \t\n\r\f");
+        if (begin == std::string_view::npos) {
+            return "";
+        }
+        auto end = str.find_last_not_of(" \t\n\r\f");
+        return std::string(str.substr(begin, end - begin + 1));
+    }
+
+    // Espaces consécutifs réduits à un seul, comme le rendu HTML
+    std::string condenseWhitespace(std::string_view text) {
+        std::string out;
+        bool inSpace = false;
+        for (char c : text) {
+            if (std::isspace(static_cast<unsigned char>(c))) {
+                if (!inSpace) out += ' ';
+                inSpace = true;
+            } else {
+                out += c;
+                inSpace = false;
+            }
+        }
+        return out;
+    }
+
+    bool hasDirective(const TemplateNode& node, const char* name) {
+        return node.directives.count(name) > 0;
+    }
+
+    bool isElementGroup(const ChildGroup& group) {
+        return group.front()->type == TemplateNode::Type::ELEMENT;
+    }
+
+    // Nombre de VNodes connus statiquement pour la préallocation
+    std::size_t staticChildCount(const std::vector<ChildGroup>& groups) {
+        std::size_t count = 0;
+        for (const auto& group : groups) {
+            if (!isElementGroup(group)) {
+                ++count;
+                continue;
+            }
+            const auto& node = *group.front();
+            if (!hasDirective(node, "for") && !hasDirective(node, "else-if") &&
+                !hasDirective(node, "else") && node.tag != "template") {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    // Blobs statiques (mode compact) : longueurs en varint LEB128, puis
+    //   nœud := 'E' tag nbAttributs (nom valeur)* nbEnfants nœud* | 'T' texte
+    //   attributs := nbAttributs (nom valeur)*
+    // Format lu par cppvue::staticTree / cppvue::staticProps
+    void appendVarint(std::string& blob, std::size_t value) {
+        while (value >= 0x80) {
+            blob += static_cast<char>((value & 0x7f) | 0x80);
+            value >>= 7;
+        }
+        blob += static_cast<char>(value);
+    }
+
+    void appendString(std::string& blob, std::string_view value) {
+        appendVarint(blob, value.size());
+        blob.append(value);
+    }
+
+    // Littéral du blob : octets non imprimables en octal sur trois chiffres
+    std::string blobLiteral(std::string_view blob) {
+        std::string out = "\"";
+        for (char c : blob) {
+            auto byte = static_cast<unsigned char>(c);
+            if (byte >= 0x20 && byte < 0x7f && c != '"' && c != '\\' && c != '?') {
+                out += c;
+            } else {
+                out += '\\';
+                out += static_cast<char>('0' + (byte >> 6));
+                out += static_cast<char>('0' + ((byte >> 3) & 7));
+                out += static_cast<char>('0' + (byte & 7));
+            }
+        }
+        return out + "\"";
+    }
+
+    struct ForClause {
+        std::string item;
+        std::string index;
+        std::string source;
+    };
+
+    ForClause parseFor(const TemplateNode& node) {
+        std::string_view spec = node.directives.at("for").content;
+        auto tokens = lexExpression(spec);
+
+        std::size_t separator = 0;
+        while (separator < tokens.size() &&
+               !(tokens[separator].kind == ExprToken::Kind::IDENTIFIER &&
+                 (tokens[separator].text == "in" || tokens[separator].text == "of"))) {
+            ++separator;
+        }
+
+        ForClause clause;
+        std::vector<std::string> names;
+        for (std::size_t i = 0; i < separator; ++i) {
+            if (tokens[i].kind == ExprToken::Kind::IDENTIFIER) {
+                names.push_back(tokens[i].text);
+            }
+        }
+        if (separator == tokens.size() || names.empty() || names.size() > 2) {
+            throw TemplateParseError(formatLocation(node) + "Invalid c-for expression: " + std::string(spec));
+        }
+
+        clause.item = names[0];
+        clause.index = names.size() > 1 ? names[1] : "";
+        auto sourceStart = spec.find(tokens[separator].text, spec.find(names.back()) + names.back().size());
+        clause.source = trimCopy(spec.substr(sourceStart + tokens[separator].text.size()));
+        return clause;
+    }
+}
+
+std::string RenderCodeGenerator::translateExpression(std::string_view expression) const {
+    auto tokens = lexExpression(expression);
+    if (tokens.empty()) {
+        throw TemplateParseError("Empty expression");
+    }
+    return translateTokens(tokens, 0, tokens.size(), locals_, symbols_);
+}
+
+std::string RenderCodeGenerator::translateHandler(std::string_view handler,
+                                                  const std::string& eventType) const {
+    auto tokens = lexExpression(handler);
+    auto locals = locals_;
+    locals.push_back("$event");
+
+    std::string prologue;
+    std::size_t begin = 0;
+    std::size_t end = tokens.size();
+
+    // Fonction fléchée : x => ..., (a, b) => ...
+    std::size_t arrow = findTopLevel(tokens, 0, tokens.size(), "=>");
+    if (arrow < tokens.size()) {
+        std::vector<std::string> params;
+        for (std::size_t i = 0; i < arrow; ++i) {
+            if (tokens[i].kind == ExprToken::Kind::IDENTIFIER) {
+                params.push_back(tokens[i].text);
+            }
+        }
+        if (!params.empty()) {
+            prologue = eventType == "std::any" ?
+                "EventArg " + params[0] + "{cppvue_event}; " :
+                "auto " + params[0] + " = cppvue_event; ";
+            locals.push_back(params[0]);
+        }
+        begin = arrow + 1;
+        if (isPunct(tokens, begin, "{") && isPunct(tokens, end - 1, "}")) {
+            ++begin;
+            --end;
+        }
+    }
+
+    std::string body = prologue;
+    while (begin < end) {
+        std::size_t stop = findTopLevel(tokens, begin, end, ";");
+        if (stop == begin) {
+            ++begin;
+            continue;
+        }
+
+        bool simpleTarget = stop - begin >= 2 &&
+            tokens[begin].kind == ExprToken::Kind::IDENTIFIER &&
+            std::find(locals.begin(), locals.end(), tokens[begin].text) == locals.end();
+        const std::string& op = tokens[begin + (stop - begin >= 2 ? 1 : 0)].text;
+
+        if (stop - begin == 1 && tokens[begin].kind == ExprToken::Kind::IDENTIFIER &&
+            std::find(locals.begin(), locals.end(), tokens[begin].text) == locals.end()) {
+            // Nom de méthode seul : appel sans argument
+            body += resolveIdentifier(symbols_, tokens[begin].text, true) + "(); ";
+        } else if (simpleTarget && stop - begin > 2 &&
+                   (op == "=" || op == "+=" || op == "-=" || op == "*=" || op == "/=")) {
+            std::string value = translateTokens(tokens, begin + 2, stop, locals, symbols_);
+            const std::string& name = assignmentTarget(symbols_, tokens[begin].text);
+            if (op != "=") {
+                value = "unref(" + name + ") " + op.substr(0, 1) + " (" + value + ")";
+            }
+            body += "assign(" + name + ", " + value + "); ";
+        } else if (simpleTarget && stop - begin == 2 && (op == "++" || op == "--")) {
+            const std::string& name = assignmentTarget(symbols_, tokens[begin].text);
+            body += "assign(" + name + ", unref(" + name + ") " + op.substr(0, 1) + " 1); ";
+        } else {
+            body += translateTokens(tokens, begin, stop, locals, symbols_) + "; ";
+        }
+        begin = stop + 1;
+    }
+    return body;
+}
+
+std::string RenderCodeGenerator::generateBody(const TemplateNode& root) {
+    out_.str("");
+    out_.clear();
+    indent_ = 1;
+    counter_ = 0;
+    locals_.clear();
+    loopIndices_.clear();
+    staticData_.clear();
+    stats_ = {};
+
+    auto groups = TemplateParser::renderedChildren(root);
+    line("using namespace cppvue::render;");
+    line("Children root;");
+    line("root.reserve(" + std::to_string(std::max<std::size_t>(staticChildCount(groups), 1)) + ");");
+    emitChildren(groups, "root");
+    line("return fragment(std::move(root));");
+    stats_.renderBytes = out_.tellp();
+    return out_.str();
+}
+
+void RenderCodeGenerator::emitChildren(const std::vector<ChildGroup>& groups, const std::string& target) {
+    for (std::size_t i = 0; i < groups.size(); ++i) {
+        const auto& group = groups[i];
+        if (!isElementGroup(group)) {
+            line(target + ".push_back(textNode(" +
+                 textExpression(group, i == 0, i + 1 == groups.size()) + "));");
+            continue;
+        }
+
+        const auto& node = *group.front();
+        if (hasDirective(node, "else-if") || hasDirective(node, "else")) {
+            throw TemplateParseError(formatLocation(node) + "c-else without a preceding c-if");
+        }
+        if (!hasDirective(node, "if")) {
+            emitNode(node, target);
+            continue;
+        }
+
+        // Chaîne c-if / c-else-if / c-else
+        line("if (truthy(" + translateExpression(node.directives.at("if").content) + ")) {");
+        ++indent_;
+        emitNode(node, target);
+        --indent_;
+
+        while (i + 1 < groups.size() && isElementGroup(groups[i + 1])) {
+            const auto& next = *groups[i + 1].front();
+            if (hasDirective(next, "else-if")) {
+                line("} else if (truthy(" +
+                     translateExpression(next.directives.at("else-if").content) + ")) {");
+            } else if (hasDirective(next, "else")) {
+                line("} else {");
+            } else {
+                break;
+            }
+            ++indent_;
+            emitNode(next, target);
+            --indent_;
+            ++i;
+            if (hasDirective(next, "else")) {
+                break;
+            }
+        }
+        line("}");
+    }
+}
+
+void RenderCodeGenerator::emitNode(const TemplateNode& node, const std::string& target) {
+    if (compact_ && isStaticSubtree(node)) {
+        std::string blob;
+        encodeStaticNode(node, blob);
+        std::string scope = scopeAttribute_.empty() ? "" : ", " + cppLiteral(scopeAttribute_);
+        line(target + ".push_back(cppvue::staticTree(" + staticBlob(blob) + scope + "));");
+    } else if (hasDirective(node, "for")) {
+        emitForLoop(node, target);
+    } else if (node.tag == "template") {
+        // <template> ne produit pas d'élément : seulement ses enfants
+        emitChildren(TemplateParser::renderedChildren(node), target);
+    } else if (TemplateParser::isComponentTag(node.tag)) {
+        emitComponent(node, target);
+    } else {
+        emitElement(node, target);
+    }
+}
+
+void RenderCodeGenerator::emitForLoop(const TemplateNode& node, const std::string& target) {
+    auto clause = parseFor(node);
+    std::string range = nextName("range");
+    std::string index = nextName("i");
+
+    line("{");
+    ++indent_;
+    line("const auto& " + range + " = " + translateExpression(clause.source) + ";");
+    line("reserveMore(" + target + ", " + range + ");");
+    line("[[maybe_unused]] std::size_t " + index + " = 0;");
+    line("for (const auto& " + clause.item + " : " + range + ") {");
+    ++indent_;
+    if (!clause.index.empty()) {
+        line("const std::size_t " + clause.index + " = " + index + ";");
+        locals_.push_back(clause.index);
+    }
+    locals_.push_back(clause.item);
+    loopIndices_.push_back(index);
+
+    if (node.tag == "template") {
+        emitChildren(TemplateParser::renderedChildren(node), target);
+    } else if (TemplateParser::isComponentTag(node.tag)) {
+        emitComponent(node, target);
+    } else {
+        emitElement(node, target);
+    }
+
+    loopIndices_.pop_back();
+    locals_.pop_back();
+    if (!clause.index.empty()) {
+        locals_.pop_back();
+    }
+    line("++" + index + ";");
+    --indent_;
+    line("}");
+    --indent_;
+    line("}");
+}
+
+void RenderCodeGenerator::emitElement(const TemplateNode& node, const std::string& target) {
+    std::string id = std::to_string(counter_++);
+    std::string n = "n" + id;
+    std::string p = "p" + id;
+    std::string c = "c" + id;
+
+    // Attributs statiques : initialisation directe de la map
+    std::string staticClass;
+    std::string initializer;
+    std::string blob;
+    std::size_t blobCount = 0;
+    bool scoped = false;
+    bool dynamicClass = node.directives.count("bind:class") > 0;
+    for (const auto& [name, expr] : node.attributes) {
+        if (name == "class" && dynamicClass) {
+            staticClass = expr.content;
+            continue;
+        }
+        initializer += (initializer.empty() ? "" : ", ") + std::string("{") +
+                       cppLiteral(name) + ", " + cppLiteral(expr.content) + "}";
+        if (isScopeAttribute(name, expr)) {
+            scoped = true;
+            continue;
+        }
+        appendString(blob, name);
+        appendString(blob, expr.content);
+        ++blobCount;
+    }
+    if (compact_ && !initializer.empty()) {
+        std::string attributes;
+        appendVarint(attributes, blobCount);
+        line("Props " + p + " = cppvue::staticProps(" + staticBlob(attributes + blob) +
+             (scoped ? ", " + cppLiteral(scopeAttribute_) : "") + ");");
+    } else {
+        line("Props " + p + (initializer.empty() ? ";" : "{" + initializer + "};"));
+    }
+    ++stats_.elements;
+
+    std::string keyExpression;
+    std::string showExpression;
+    // Handlers par événement DOM (@keyup.enter et @keyup.esc partagent le listener keyup)
+    struct EventHandlers {
+        std::string event;
+        std::string captures;
+        std::vector<std::string> bodies;
+    };
+    std::vector<EventHandlers> events;
+    auto addHandler = [&events](std::string event, std::string body, std::string capture = "") {
+        auto it = std::find_if(events.begin(), events.end(),
+                               [&](const EventHandlers& handlers) { return handlers.event == event; });
+        if (it == events.end()) {
+            it = events.insert(events.end(), EventHandlers{std::move(event), "", {}});
+        }
+        it->captures += capture;
+        it->bodies.push_back(std::move(body));
+    };
+    std::string textDirective;
+    std::string htmlDirective;
+
+    for (const auto& [name, expr] : node.directives) {
+        if (expr.type == ExpressionType::BINDING) {
+            if (expr.arg.empty()) {
+                throw TemplateParseError(formatLocation(node) + "c-bind without argument is not supported");
+            }
+            auto tokens = lexExpression(expr.content);
+            if (expr.arg == "key") {
+                keyExpression = translateExpression(expr.content);
+            } else if (expr.arg == "class" && isPunct(tokens, 0, "{") && isPunct(tokens, tokens.size() - 1, "}")) {
+                // Objet { nom: condition, ... }
+                std::string entries;
+                std::size_t begin = 1;
+                std::size_t end = tokens.size() - 1;
+                while (begin < end) {
+                    std::size_t comma = findTopLevel(tokens, begin, end, ",");
+                    std::size_t colon = findTopLevel(tokens, begin, comma, ":");
+                    if (colon != begin + 1) {
+                        throw TemplateParseError(formatLocation(node) + "Invalid class binding: " + std::string(expr.content));
+                    }
+                    entries += (entries.empty() ? "" : ", ") + std::string("{") +
+                               cppLiteral(tokens[begin].text) + ", truthy(" +
+                               translateTokens(tokens, colon + 1, comma, locals_, symbols_) + ")}";
+                    begin = comma + 1;
+                }
+                line(p + "[\"class\"] = joinClass(" + cppLiteral(staticClass) +
+                     ", classList({" + entries + "}));");
+            } else if (expr.arg == "class") {
+                line(p + "[\"class\"] = joinClass(" + cppLiteral(staticClass) +
+                     ", toDisplayString(" + translateExpression(expr.content) + "));");
+            } else {
+                line("bindProp(" + p + ", " + cppLiteral(expr.arg) + ", " +
+                     translateExpression(expr.content) + ");");
+            }
+        } else if (expr.type == ExpressionType::EVENT) {
+            std::string body = translateHandler(expr.content, "void*");
+            if (expr.modifiers.empty()) {
+                addHandler(std::string(expr.arg), std::move(body));
+            } else {
+                std::string handler = std::string(expr.arg) + "." + std::string(expr.modifiers);
+                std::size_t index = 0;
+                for (const auto& handlers : events) {
+                    index += handlers.bodies.size();
+                }
+                std::string once = "cppvue_once" + std::to_string(index);
+                body = applyEventModifiers(node, expr.modifiers, body, once);
+                std::string capture = body.find(once) == std::string::npos ? "" :
+                    ", " + once + " = onceFlag(*" + n + ", " + cppLiteral(handler) + ")";
+                addHandler(std::string(expr.arg), std::move(body), std::move(capture));
+            }
+        } else if (name == "model") {
+            auto tokens = lexExpression(expr.content);
+            std::string targetName = tokens.size() == 1 ? tokens[0].text : "";
+            if (targetName.empty() || std::find(locals_.begin(), locals_.end(), targetName) != locals_.end()) {
+                throw TemplateParseError(formatLocation(node) + "c-model needs a component member: " + std::string(expr.content));
+            }
+            assignmentTarget(symbols_, targetName);
+            const auto* type = node.attributes.find("type");
+            if (type != nullptr && type->content == "checkbox") {
+                line("bindProp(" + p + ", \"checked\", truthy(unref(" + targetName + ")));");
+                addHandler("change", "assign(" + targetName + ", !truthy(unref(" + targetName + "))); ");
+            } else if (type != nullptr && type->content == "radio") {
+                // Coché si le modèle vaut la valeur du bouton ; le choix y écrit cette valeur
+                const auto* value = node.attributes.find("value");
+                const auto* boundValue = node.directives.find("bind:value");
+                std::string option = boundValue != nullptr ?
+                    "toDisplayString(" + translateExpression(boundValue->content) + ")" :
+                    "std::string(" + cppLiteral(value != nullptr ? value->content : "on") + ")";
+                line("bindProp(" + p + ", \"checked\", toDisplayString(unref(" + targetName + ")) == " + option + ");");
+                addHandler("change", "assign(" + targetName + ", eventValue(cppvue_event)); ");
+            } else {
+                line("bindProp(" + p + ", \"value\", unref(" + targetName + "));");
+                addHandler("input", "assign(" + targetName + ", eventValue(cppvue_event)); ");
+            }
+        } else if (name == "show") {
+            showExpression = translateExpression(expr.content);
+        } else if (name == "text") {
+            textDirective = translateExpression(expr.content);
+        } else if (name == "html") {
+            htmlDirective = translateExpression(expr.content);
+        } else if (name != "if" && name != "else-if" && name != "else" && name != "for") {
+            throw TemplateParseError(formatLocation(node) + "Unsupported directive: c-" + std::string(name));
+        }
+    }
+    if (!showExpression.empty()) {
+        line("showIf(" + p + ", " + showExpression + ");");
+    }
+
+    // Enfants : vecteur préalloué à la taille connue ; c-html remplace les enfants
+    auto groups = TemplateParser::renderedChildren(node);
+    bool hasChildren = htmlDirective.empty() && (!textDirective.empty() || !groups.empty());
+    if (hasChildren) {
+        line("Children " + c + ";");
+        if (!textDirective.empty()) {
+            line(c + ".push_back(textNode(toDisplayString(" + textDirective + ")));");
+        } else {
+            line(c + ".reserve(" + std::to_string(std::max<std::size_t>(staticChildCount(groups), 1)) + ");");
+            emitChildren(groups, c);
+        }
+    }
+
+    line("auto " + n + " = element(" + cppLiteral(node.tag) + ", std::move(" + p + "), " +
+         (hasChildren ? "std::move(" + c + ")" : "{}") + ");");
+    if (!htmlDirective.empty()) {
+        line(n + "->innerHTML = toDisplayString(" + htmlDirective + ");");
+    }
+    for (const auto& handlers : events) {
+        stats_.handlers += handlers.bodies.size();
+        std::string body = handlers.bodies.size() == 1 ? handlers.bodies.front() : "";
+        if (handlers.bodies.size() > 1) {
+            for (const auto& handler : handlers.bodies) {
+                body += "{ " + handler + "} ";
+            }
+        }
+        line(n + "->events[" + cppLiteral(handlers.event) + "] = DomHandler([=, this" + handlers.captures +
+             "]([[maybe_unused]] void* cppvue_event) { " + body + "});");
+    }
+    if (!keyExpression.empty()) {
+        line("keyed(" + n + ", " + keyExpression + ");");
+    }
+
+    // Corps de c-for à structure fixe : instancié par clonage du squelette
+    std::string value = "std::move(" + n + ")";
+    if (hasDirective(node, "for")) {
+        if (auto skeleton = TemplateParser::analyzeStaticSkeleton(node)) {
+            value = "cppvue::withTemplate(" + value + ", " +
+                    TemplateParser::templateVariableName(*skeleton) + ")";
+        }
+    }
+    line(target + ".push_back(" + value + ");");
+}
+
+std::string RenderCodeGenerator::applyEventModifiers(const TemplateNode& node, std::string_view modifiers,
+                                                     const std::string& body,
+                                                     const std::string& onceVariable) const {
+    std::vector<std::string_view> list;
+    for (std::size_t start = 0; start <= modifiers.size();) {
+        std::size_t dot = std::min(modifiers.find('.', start), modifiers.size());
+        list.push_back(modifiers.substr(start, dot - start));
+        start = dot + 1;
+    }
+
+    // Les filtres de touche passent en premier (withKeys de Vue), une seule suffit
+    std::string keys;
+    for (auto modifier : list) {
+        if (modifier == "capture" || modifier == "passive" || modifier == "exact" || modifier.empty()) {
+            throw TemplateParseError(formatLocation(node) + "Unsupported event modifier: ." + std::string(modifier));
+        }
+        if (modifier != "stop" && modifier != "prevent" && modifier != "self" && modifier != "once" &&
+            modifier != "ctrl" && modifier != "alt" && modifier != "shift" && modifier != "meta") {
+            keys += (keys.empty() ? "" : " || ") + std::string("eventKeyIs(cppvue_event, ") +
+                    cppLiteral(modifier) + ")";
+        }
+    }
+
+    std::string code;
+    int blocks = 0;
+    if (!keys.empty()) {
+        code += "if (" + keys + ") { ";
+        ++blocks;
+    }
+    for (auto modifier : list) {
+        if (modifier == "stop") {
+            code += "stopPropagation(cppvue_event); ";
+        } else if (modifier == "prevent") {
+            code += "preventDefault(cppvue_event); ";
+        } else if (modifier == "self") {
+            code += "if (eventIsSelf(cppvue_event)) { ";
+            ++blocks;
+        } else if (modifier == "once") {
+            code += "if (!*" + onceVariable + ") { *" + onceVariable + " = true; ";
+            ++blocks;
+        } else if (modifier == "ctrl" || modifier == "alt" || modifier == "shift" || modifier == "meta") {
+            code += "if (eventSystemKey(cppvue_event, " + cppLiteral(modifier) + ")) { ";
+            ++blocks;
+        }
+    }
+    code += body;
+    for (int i = 0; i < blocks; ++i) {
+        code += "} ";
+    }
+    return code;
+}
+
+void RenderCodeGenerator::emitComponent(const TemplateNode& node, const std::string& target) {
+    std::string id = std::to_string(counter_++);
+    std::string n = "n" + id;
+
+    std::string props;
+    for (const auto& [name, expr] : node.attributes) {
+        props += (props.empty() ? "" : ", ") + std::string("{") + cppLiteral(name) +
+                 ", std::any(std::string(" + cppLiteral(expr.content) + "))}";
+    }
+
+    // Clé de l'instance : position dans le template, puis :key ou index de boucle
+    std::string key = cppLiteral(std::string(node.tag) + ":" + id);
+    std::string handlers;
+    std::string showExpression;
+
+    for (const auto& [name, expr] : node.directives) {
+        if (expr.type == ExpressionType::BINDING && expr.arg == "key") {
+            key = "std::string(" + key + ") + \":\" + toDisplayString(" +
+                  translateExpression(expr.content) + ")";
+        } else if (expr.type == ExpressionType::BINDING) {
+            props += (props.empty() ? "" : ", ") + std::string("{") + cppLiteral(expr.arg) +
+                     ", std::any(" + translateExpression(expr.content) + ")}";
+        } else if (expr.type == ExpressionType::EVENT) {
+            ++stats_.handlers;
+            handlers += (handlers.empty() ? "" : ", ") + std::string("{") + cppLiteral(expr.arg) +
+                        ", ComponentHandler([=, this]([[maybe_unused]] std::any cppvue_event) { " +
+                        translateHandler(expr.content, "std::any") + "})}";
+        } else if (name == "show") {
+            showExpression = translateExpression(expr.content);
+        } else if (name != "if" && name != "else-if" && name != "else" && name != "for") {
+            throw TemplateParseError(formatLocation(node) + "Unsupported directive on component: c-" + std::string(name));
+        }
+    }
+    if (node.directives.count("bind:key") == 0 && !loopIndices_.empty()) {
+        key = "std::string(" + key + ")";
+        for (const auto& index : loopIndices_) {
+            key += " + \":\" + std::to_string(" + index + ")";
+        }
+    }
+
+    ++stats_.elements;
+    line("auto " + n + " = component<" + TemplateParser::componentClassName(node.tag) + ">(this, " + key +
+         ", {" + props + "}, {" + handlers + "});");
+    if (!showExpression.empty()) {
+        line("showIf(" + n + "->props, " + showExpression + ");");
+    }
+    line(target + ".push_back(std::move(" + n + "));");
+}
+
+std::vector<std::pair<bool, std::string>> RenderCodeGenerator::textParts(const ChildGroup& group, bool trimStart,
+                                                                       bool trimEnd) const {
+    // Morceaux (expression ?, texte) avec espaces condensés
+    std::vector<std::pair<bool, std::string>> parts;
+    for (const auto& part : group) {
+        if (part->type == TemplateNode::Type::EXPRESSION) {
+            parts.emplace_back(true, translateExpression(part->content));
+        } else if (!parts.empty() && !parts.back().first) {
+            parts.back().second = condenseWhitespace(parts.back().second.append(part->content));
+        } else {
+            parts.emplace_back(false, condenseWhitespace(part->content));
+        }
+    }
+    if (trimStart && !parts.empty() && !parts.front().first) {
+        auto& text = parts.front().second;
+        text.erase(0, text.find_first_not_of(' '));
+    }
+    if (trimEnd && !parts.empty() && !parts.back().first) {
+        auto& text = parts.back().second;
+        auto last = text.find_last_not_of(' ');
+        text.erase(last == std::string::npos ? 0 : last + 1);
+    }
+    return parts;
+}
+
+std::string RenderCodeGenerator::textExpression(const ChildGroup& group, bool trimStart, bool trimEnd) const {
+    auto parts = textParts(group, trimStart, trimEnd);
+    std::string code;
+    bool dynamic = std::any_of(parts.begin(), parts.end(), [](const auto& part) { return part.first; });
+    for (const auto& [isExpression, value] : parts) {
+        if (!isExpression && value.empty()) {
+            continue;
+        }
+        if (!code.empty()) {
+            code += " + ";
+        }
+        if (isExpression) {
+            code += "toDisplayString(" + value + ")";
+        } else if (dynamic && code.empty()) {
+            code += "std::string(" + cppLiteral(value) + ")";
+        } else {
+            code += cppLiteral(value);
+        }
+    }
+    return code.empty() ? "\"\"" : code;
+}
+
+bool RenderCodeGenerator::isStaticSubtree(const TemplateNode& node) const {
+    // Élément sans directive dont tous les descendants sont des éléments du même
+    // genre ou du texte sans interpolation : son VNode ne dépend de rien
+    if (node.type != TemplateNode::Type::ELEMENT || !node.directives.empty() ||
+        node.tag == "template" || TemplateParser::isComponentTag(node.tag)) {
+        return false;
+    }
+    return std::all_of(node.children.begin(), node.children.end(), [&](const TemplateNode* child) {
+        return child->type == TemplateNode::Type::TEXT ||
+               (child->type == TemplateNode::Type::ELEMENT && isStaticSubtree(*child));
+    });
+}
+
+void RenderCodeGenerator::encodeStaticNode(const TemplateNode& node, std::string& blob) {
+    // Mêmes VNodes que emitElement : attributs tels quels, texte condensé et
+    // rogné aux bords comme textExpression. Le compteur avance comme pour un
+    // élément émis : les clés des composants suivants ne dépendent pas du mode
+    ++counter_;
+    ++stats_.staticNodes;
+    blob += 'E';
+    appendString(blob, node.tag);
+    std::size_t count = node.attributes.size();
+    const auto* scope = node.attributes.find(scopeAttribute_);
+    if (scope != nullptr && isScopeAttribute(scopeAttribute_, *scope)) {
+        --count;  // Posé par staticTree sur chaque élément
+    }
+    appendVarint(blob, count);
+    for (const auto& [name, expr] : node.attributes) {
+        if (isScopeAttribute(name, expr)) {
+            continue;
+        }
+        appendString(blob, name);
+        appendString(blob, expr.content);
+    }
+
+    auto groups = TemplateParser::renderedChildren(node);
+    appendVarint(blob, groups.size());
+    for (std::size_t i = 0; i < groups.size(); ++i) {
+        if (isElementGroup(groups[i])) {
+            encodeStaticNode(*groups[i].front(), blob);
+            continue;
+        }
+        std::string text;
+        for (const auto& part : textParts(groups[i], i == 0, i + 1 == groups.size())) {
+            text += part.second;
+        }
+        ++stats_.staticNodes;
+        blob += 'T';
+        appendString(blob, text);
+    }
+}
+
+bool RenderCodeGenerator::isScopeAttribute(std::string_view name, const Expression& value) const {
+    return !scopeAttribute_.empty() && name == scopeAttribute_ && value.content.empty();
+}
+
+std::string RenderCodeGenerator::staticBlob(const std::string& blob) {
+    // Nommé par son contenu : une définition inline par blob distinct dans le
+    // programme, gardée par une macro pour les builds unity
+    std::uint64_t hash = BuildCache::hashBytes(blob);
+    std::ostringstream name;
+    name << "blob_" << std::hex << hash;
+
+    bool known = std::any_of(stats_.blobs.begin(), stats_.blobs.end(),
+                             [hash](const auto& entry) { return entry.first == hash; });
+    if (!known) {
+        stats_.blobs.emplace_back(hash, blob.size());
+        stats_.staticBytes += blob.size();
+        staticData_ += "#ifndef CPPVUE_STATIC_" + name.str() + "\n";
+        staticData_ += "#define CPPVUE_STATIC_" + name.str() + "\n";
+        staticData_ += "namespace cppvue_static { inline constexpr std::string_view " + name.str() + "{" +
+                       blobLiteral(blob) + ", " + std::to_string(blob.size()) + "}; }\n";
+        staticData_ += "#endif\n";
+    }
+    return "cppvue_static::" + name.str();
+}
+
+std::string RenderCodeGenerator::nextName(const std::string& prefix) {
+    return prefix + std::to_string(counter_++);
+}
+
+void RenderCodeGenerator::line(const std::string& code) {
+    out_ << std::string(indent_ * 4, ' ') << code << "\n";
+}
+
+} // namespace cppvue::compiler
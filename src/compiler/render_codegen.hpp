@@ -0,0 +1,102 @@
+#pragma once
+
+#include "template_parser.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace cppvue::compiler {
+
+// Contribution d'un composant au code généré (cvuec --size-report)
+struct CodeSizeStats {
+    std::size_t renderBytes = 0;        // Source C++ de render()
+    std::size_t elements = 0;           // Éléments et composants construits par du code
+    std::size_t handlers = 0;           // Lambdas de handlers (une instanciation chacune)
+    std::size_t staticNodes = 0;        // VNodes décrits par des blobs statiques
+    std::size_t staticBytes = 0;        // Octets de blobs définis par le composant
+    std::vector<std::pair<std::uint64_t, std::size_t>> blobs;  // Hash et taille des blobs utilisés
+};
+
+// Noms déclarés par la classe du composant, pour résoudre les identifiants
+// des expressions : membre (unref(nom)), prop (accesseur nom() de CPPVUE_PROP)
+// ou erreur de compilation. known est faux si la classe n'a pas été trouvée :
+// les identifiants sont alors tous traités comme des membres.
+struct ComponentSymbols {
+    bool known = false;
+    std::unordered_set<std::string> members;
+    std::unordered_set<std::string> props;
+};
+
+// Générateur du corps de render() à partir de l'AST du template.
+// Chaque élément devient une construction directe de VNode (props typées,
+// enfants préalloués), c-if/c-for deviennent des if/for C++ et les expressions
+// sont traduites en accès directs aux membres du composant.
+//
+// En mode compact, les sous-arbres entièrement statiques et les jeux
+// d'attributs statiques deviennent des blobs de données (cppvue::staticTree /
+// cppvue::staticProps) nommés par leur hash : identiques d'un composant à
+// l'autre, ils sont fusionnés par l'éditeur de liens au lieu d'être
+// reconstruits par du code dans chaque render(). L'attribut de <style scoped>
+// (scopeAttribute) reste hors des blobs pour qu'ils restent partageables.
+class RenderCodeGenerator {
+public:
+    explicit RenderCodeGenerator(bool compact = false, std::string scopeAttribute = "",
+                                 ComponentSymbols symbols = {})
+        : compact_(compact), scopeAttribute_(std::move(scopeAttribute)), symbols_(std::move(symbols)) {}
+
+    // Instructions C++ du corps de render() pour la racine renvoyée par TemplateParser::parse
+    std::string generateBody(const TemplateNode& root);
+
+    // Traduit une expression de template (syntaxe JavaScript simple) en expression C++
+    std::string translateExpression(std::string_view expression) const;
+
+    // Traduit un handler (@event) en instructions C++ ; eventType est le type de $event
+    std::string translateHandler(std::string_view handler, const std::string& eventType) const;
+
+    // Définitions des blobs utilisés par le dernier generateBody, à placer avant render()
+    const std::string& staticData() const { return staticData_; }
+    const CodeSizeStats& stats() const { return stats_; }
+
+private:
+    void emitChildren(const std::vector<ChildGroup>& groups, const std::string& target);
+    void emitElement(const TemplateNode& node, const std::string& target);
+    void emitForLoop(const TemplateNode& node, const std::string& target);
+    void emitNode(const TemplateNode& node, const std::string& target);
+    void emitComponent(const TemplateNode& node, const std::string& target);
+    // Handler @event.modifiers : filtres de touche, puis .stop/.prevent/.self/.once
+    // dans l'ordre d'écriture ; onceVariable est l'état capturé pour .once
+    std::string applyEventModifiers(const TemplateNode& node, std::string_view modifiers,
+                                    const std::string& body, const std::string& onceVariable) const;
+    std::string textExpression(const ChildGroup& group, bool trimStart, bool trimEnd) const;
+    std::vector<std::pair<bool, std::string>> textParts(const ChildGroup& group, bool trimStart,
+                                                        bool trimEnd) const;
+
+    // Mode compact
+    bool isStaticSubtree(const TemplateNode& node) const;
+    void encodeStaticNode(const TemplateNode& node, std::string& blob);
+    std::string staticBlob(const std::string& blob);
+    bool isScopeAttribute(std::string_view name, const Expression& value) const;
+
+    std::string nextName(const std::string& prefix);
+    void line(const std::string& code);
+
+    std::ostringstream out_;
+    int indent_ = 1;
+    int counter_ = 0;
+    std::vector<std::string> locals_;       // Variables de boucle visibles
+    std::vector<std::string> loopIndices_;  // Compteurs des c-for englobants
+
+    bool compact_;
+    std::string scopeAttribute_;
+    ComponentSymbols symbols_;
+    std::string staticData_;
+    CodeSizeStats stats_;
+};
+
+} // namespace cppvue::compiler
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+namespace cppvue::compiler {
+
+// Vecteur à capacité locale : les N premiers éléments restent dans l'objet,
+// le tas n'est utilisé qu'au-delà. Réservé aux types trivialement copiables
+// (pointeurs, vues, entrées d'attributs), déplacés par memcpy.
+template<typename T, std::size_t N>
+class SmallVector {
+    static_assert(std::is_trivially_copyable_v<T>, "SmallVector holds trivially copyable types");
+
+public:
+    SmallVector() = default;
+    ~SmallVector() {
+        if (data_ != inlineData()) {
+            std::free(data_);
+        }
+    }
+
+    SmallVector(const SmallVector&) = delete;
+    SmallVector& operator=(const SmallVector&) = delete;
+
+    void push_back(const T& value) {
+        if (size_ == capacity_) {
+            grow();
+        }
+        data_[size_++] = value;
+    }
+
+    // Insère value à la position index (décale la suite)
+    void insert(std::size_t index, const T& value) {
+        if (size_ == capacity_) {
+            grow();
+        }
+        std::memmove(static_cast<void*>(data_ + index + 1), data_ + index, (size_ - index) * sizeof(T));
+        data_[index] = value;
+        ++size_;
+    }
+
+    void pop_back() { --size_; }
+    void resize(std::size_t size) {
+        while (capacity_ < size) {
+            grow();
+        }
+        size_ = size;
+    }
+    void clear() { size_ = 0; }
+
+    T* data() { return data_; }
+    const T* data() const { return data_; }
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    T& operator[](std::size_t index) { return data_[index]; }
+    const T& operator[](std::size_t index) const { return data_[index]; }
+    T& back() { return data_[size_ - 1]; }
+
+    T* begin() { return data_; }
+    T* end() { return data_ + size_; }
+    const T* begin() const { return data_; }
+    const T* end() const { return data_ + size_; }
+
+private:
+    void grow() {
+        std::size_t capacity = capacity_ * 2;
+        auto* data = static_cast<T*>(std::malloc(capacity * sizeof(T)));
+        if (data == nullptr) {
+            throw std::bad_alloc();
+        }
+        std::memcpy(static_cast<void*>(data), data_, size_ * sizeof(T));
+        if (data_ != inlineData()) {
+            std::free(data_);
+        }
+        data_ = data;
+        capacity_ = capacity;
+    }
+
+    T* inlineData() { return reinterpret_cast<T*>(inline_); }
+
+    alignas(T) std::byte inline_[N * sizeof(T)];
+    T* data_ = inlineData();
+    std::size_t size_ = 0;
+    std::size_t capacity_ = N;
+};
+
+} // namespace cppvue::compiler
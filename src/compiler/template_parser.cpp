@@ -1,19 +1,14 @@
 #include "template_parser.hpp"
-#include <regex>
-#include <stack>
+#include "template_tokenizer.hpp"
+#include "render_codegen.hpp"
+#include "small_vector.hpp"
+#include <algorithm>
+#include <cctype>
 #include <sstream>
 
 namespace cppvue::compiler {
 
 namespace {
-    // Regex pour le parsing
-    const std::regex TAG_REGEX("<([/]?)([^>\\s]+)\\s*([^>]*)>");
-    const std::regex ATTR_REGEX("([^\\s=]+)(?:=([\"'])(.*?)\\2)?");
-    const std::regex INTERP_REGEX("\\{\\{\\s*(.+?)\\s*\\}\\}");
-    const std::regex DIR_REGEX("c-([^:\\s]+)(?::([^.\\s]+))?(?:\\.([^\\s]+))?");
-    const std::regex EVENT_REGEX("@([^.\\s]+)(?:\\.([^\\s]+))?");
-    const std::regex BIND_REGEX(":([^\\s]+)");
-    
     // Helper pour échapper les chaînes C++
     std::string escapeString(const std::string& str) {
         std::stringstream ss;
@@ -29,239 +24,471 @@ namespace {
         }
         return ss.str();
     }
-}
-
-std::shared_ptr<TemplateNode> TemplateParser::parse(const std::string& template_content) {
-    std::stack<std::shared_ptr<TemplateNode>> nodeStack;
-    auto root = TemplateNode::createElement("template");
-    nodeStack.push(root);
     
-    std::string::const_iterator searchStart(template_content.cbegin());
-    std::smatch matches;
+    bool isVoidTag(std::string_view tag) {
+        return tag == "img" || tag == "input" || tag == "br" ||
+               tag == "hr" || tag == "meta";
+    }
+    
+    std::string formatLocation(const SourceLocation& location) {
+        return std::to_string(location.line) + ":" + std::to_string(location.column) + ": ";
+    }
+    
+    // Sépare "nom:arg.modificateurs"
+    std::string_view splitDirective(std::string_view spec, Expression& expr) {
+        auto colon = spec.find(':');
+        auto dot = spec.find('.', colon == std::string_view::npos ? 0 : colon);
+        auto nameEnd = std::min(colon, dot);
+        
+        if (colon != std::string_view::npos) {
+            expr.arg = spec.substr(colon + 1, dot == std::string_view::npos ?
+                std::string_view::npos : dot - colon - 1);
+        }
+        if (dot != std::string_view::npos) {
+            expr.modifiers = spec.substr(dot + 1);
+        }
+        return spec.substr(0, nameEnd);
+    }
+    
+    // Attributs ou directives d'un élément en cours de parsing, triés par nom
+    using EntryList = SmallVector<ExpressionEntry, 8>;
+    
+    // Insère en gardant l'ordre ; un nom répété remplace l'entrée précédente
+    void insertEntry(EntryList& entries, std::string_view name, const Expression& expr) {
+        auto it = std::lower_bound(entries.begin(), entries.end(), name,
+            [](const ExpressionEntry& entry, std::string_view key) { return entry.name < key; });
+        if (it != entries.end() && it->name == name) {
+            it->expr = expr;
+        } else {
+            entries.insert(static_cast<std::size_t>(it - entries.begin()), {name, expr});
+        }
+    }
+    
+    // Clé composée ("bind:x", "on:keyup.enter") copiée dans l'arène
+    std::string_view directiveKey(Arena& arena, std::string_view prefix, std::string_view arg,
+                                  std::string_view modifiers = {}) {
+        std::size_t size = prefix.size() + arg.size() + (modifiers.empty() ? 0 : modifiers.size() + 1);
+        auto* key = static_cast<char*>(arena.allocate(size, 1));
+        char* out = std::copy(prefix.begin(), prefix.end(), key);
+        out = std::copy(arg.begin(), arg.end(), out);
+        if (!modifiers.empty()) {
+            *out++ = '.';
+            std::copy(modifiers.begin(), modifiers.end(), out);
+        }
+        return {key, size};
+    }
     
-    while (std::regex_search(searchStart, template_content.cend(), matches, TAG_REGEX)) {
-        // Traite le texte avant le tag
-        if (matches.prefix().length() > 0) {
-            std::string text = matches.prefix().str();
-            // Parse les interpolations dans le texte
-            std::string::const_iterator textStart(text.cbegin());
-            std::smatch interpMatches;
+    // Classe un attribut : directive c-*, événement @, binding : ou attribut normal
+    void addAttribute(Arena& arena, EntryList& attributes, EntryList& directives,
+                      const TemplateAttribute& attribute) {
+        Expression expr{ExpressionType::TEXT, attribute.value, {}, {}};
+        std::string_view name = attribute.name;
+        
+        // Les directives acceptent aussi le préfixe v- de Vue
+        if (name.size() > 2 && (name.substr(0, 2) == "c-" || name.substr(0, 2) == "v-")) {
+            expr.type = ExpressionType::DIRECTIVE;
+            std::string_view directiveName = splitDirective(name.substr(2), expr);
             
-            while (std::regex_search(textStart, text.cend(), interpMatches, INTERP_REGEX)) {
-                if (interpMatches.prefix().length() > 0) {
-                    nodeStack.top()->children.push_back(
-                        TemplateNode::createText(interpMatches.prefix().str()));
-                }
-                
-                auto expr = TemplateNode::createExpression(interpMatches[1].str());
-                nodeStack.top()->children.push_back(expr);
-                
-                textStart = interpMatches.suffix().first;
+            // c-bind:x et c-on:x sont indexés par argument pour ne pas s'écraser ;
+            // les modificateurs distinguent @keyup.enter de @keyup.esc
+            if (directiveName == "bind") {
+                expr.type = ExpressionType::BINDING;
+                insertEntry(directives, directiveKey(arena, "bind:", expr.arg), expr);
+            } else if (directiveName == "on") {
+                expr.type = ExpressionType::EVENT;
+                insertEntry(directives, directiveKey(arena, "on:", expr.arg, expr.modifiers), expr);
+            } else {
+                insertEntry(directives, directiveName, expr);
             }
-            
-            if (textStart != text.cend()) {
-                nodeStack.top()->children.push_back(
-                    TemplateNode::createText(std::string(textStart, text.cend())));
+        } else if (name.size() > 1 && name.front() == '@') {
+            auto dot = name.find('.');
+            expr.type = ExpressionType::EVENT;
+            expr.arg = name.substr(1, dot == std::string_view::npos ? std::string_view::npos : dot - 1);
+            if (dot != std::string_view::npos) {
+                expr.modifiers = name.substr(dot + 1);
             }
+            insertEntry(directives, directiveKey(arena, "on:", expr.arg, expr.modifiers), expr);
+        } else if (name.size() > 1 && name.front() == ':') {
+            expr.type = ExpressionType::BINDING;
+            expr.arg = name.substr(1);
+            insertEntry(directives, directiveKey(arena, "bind:", expr.arg), expr);
+        } else {
+            insertEntry(attributes, name, expr);
+        }
+    }
+    
+    bool isBlank(std::string_view str) {
+        return str.find_first_not_of(" \t\r\n") == std::string_view::npos;
+    }
+    
+    // Hash FNV-1a 64 bits, stable entre compilations
+    std::uint64_t fnv1a(const std::string& str) {
+        std::uint64_t hash = 14695981039346656037ull;
+        for (unsigned char c : str) {
+            hash ^= c;
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+    
+    // Parcourt un corps de c-for : construit la signature structurelle et les emplacements
+    bool collectSkeleton(const TemplateNode& node,
+                         std::vector<int>& path,
+                         bool isRoot,
+                         std::string& signature,
+                         std::vector<SkeletonSlot>& slots) {
+        // <template> est aplati par le rendu : les chemins des emplacements
+        // ne correspondraient plus aux nœuds du clone
+        if (TemplateParser::isComponentTag(node.tag) || node.tag == "template") {
+            return false;
         }
         
-        bool isClosing = matches[1].length() > 0;
-        std::string tagName = matches[2];
-        std::string attrs = matches[3];
-        
-        if (isClosing) {
-            if (nodeStack.empty() || nodeStack.top()->tag != tagName) {
-                throw TemplateParseError("Mismatched closing tag: " + tagName);
+        std::vector<std::string> dynamicProps;
+        for (const auto& [name, expr] : node.directives) {
+            if (name == "for" && isRoot) {
+                continue;
+            } else if (expr.type == ExpressionType::BINDING) {
+                if (expr.arg != "key") {
+                    dynamicProps.emplace_back(expr.arg);
+                }
+            } else if (name == "model") {
+                dynamicProps.emplace_back(TemplateParser::modelProperty(node));
+            } else if (name == "show") {
+                dynamicProps.push_back("style");
+            } else if (expr.type != ExpressionType::EVENT) {
+                // c-if, c-else, c-for imbriqué, c-html... : structure variable
+                return false;
             }
-            nodeStack.pop();
-        } else {
-            auto node = TemplateNode::createElement(tagName);
-            
-            // Parse les attributs
-            std::string::const_iterator attrStart(attrs.cbegin());
-            std::smatch attrMatches;
+        }
+        std::sort(dynamicProps.begin(), dynamicProps.end());
+        
+        // Attributs déjà triés par nom
+        signature += "<";
+        signature += node.tag;
+        for (const auto& [name, expr] : node.attributes) {
+            signature += " ";
+            signature += name;
+            signature += "=\"";
+            signature += expr.content;
+            signature += "\"";
+        }
+        for (const auto& name : dynamicProps) {
+            signature += " :" + name;
+        }
+        signature += ">";
+        
+        if (!dynamicProps.empty()) {
+            slots.push_back({path, dynamicProps, false});
+        }
+        
+        auto groups = TemplateParser::renderedChildren(node);
+        for (std::size_t i = 0; i < groups.size(); ++i) {
+            const auto& group = groups[i];
+            path.push_back(static_cast<int>(i));
             
-            while (std::regex_search(attrStart, attrs.cend(), attrMatches, ATTR_REGEX)) {
-                std::string attrName = attrMatches[1];
-                std::string attrValue = attrMatches[3];
-                
-                // Vérifie si c'est une directive
-                std::smatch dirMatches;
-                if (std::regex_match(attrName, dirMatches, DIR_REGEX)) {
-                    Expression expr;
-                    expr.type = ExpressionType::DIRECTIVE;
-                    expr.content = attrValue;
-                    expr.arg = dirMatches[2];
-                    expr.modifiers = dirMatches[3];
-                    node->directives[dirMatches[1]] = expr;
+            if (group.front()->type == TemplateNode::Type::ELEMENT) {
+                if (!collectSkeleton(*group.front(), path, false, signature, slots)) {
+                    return false;
                 }
-                // Vérifie si c'est un événement
-                else if (std::regex_match(attrName, dirMatches, EVENT_REGEX)) {
-                    Expression expr;
-                    expr.type = ExpressionType::EVENT;
-                    expr.content = attrValue;
-                    expr.arg = dirMatches[1];
-                    expr.modifiers = dirMatches[2];
-                    node->directives["on"] = expr;
+            } else {
+                bool dynamicText = false;
+                for (const auto& part : group) {
+                    if (part->type == TemplateNode::Type::EXPRESSION) {
+                        dynamicText = true;
+                        signature += "{{}}";
+                    } else {
+                        signature += part->content;
+                    }
                 }
-                // Vérifie si c'est un binding
-                else if (std::regex_match(attrName, dirMatches, BIND_REGEX)) {
-                    Expression expr;
-                    expr.type = ExpressionType::BINDING;
-                    expr.content = attrValue;
-                    expr.arg = dirMatches[1];
-                    node->directives["bind"] = expr;
+                if (dynamicText) {
+                    slots.push_back({path, {}, true});
                 }
-                // Attribut normal
-                else {
-                    Expression expr;
-                    expr.type = ExpressionType::TEXT;
-                    expr.content = attrValue;
-                    node->attributes[attrName] = expr;
-                }
-                
-                attrStart = attrMatches.suffix().first;
             }
             
-            nodeStack.top()->children.push_back(node);
-            
-            // Si ce n'est pas un tag auto-fermant, l'ajoute à la pile
-            if (tagName != "img" && tagName != "input" && tagName != "br" && 
-                tagName != "hr" && tagName != "meta") {
-                nodeStack.push(node);
-            }
+            path.pop_back();
         }
         
-        searchStart = matches.suffix().first;
+        signature += "</";
+        signature += node.tag;
+        signature += ">";
+        return true;
     }
     
-    // Traite le texte restant
-    if (searchStart != template_content.cend()) {
-        std::string remainingText(searchStart, template_content.cend());
-        if (!remainingText.empty()) {
-            nodeStack.top()->children.push_back(
-                TemplateNode::createText(remainingText));
+    void collectSkeletons(const TemplateNode& node, std::vector<StaticSkeleton>& skeletons) {
+        if (auto skeleton = TemplateParser::analyzeStaticSkeleton(node)) {
+            bool known = std::any_of(skeletons.begin(), skeletons.end(),
+                [&](const StaticSkeleton& other) { return other.hash == skeleton->hash; });
+            if (!known) {
+                skeletons.push_back(std::move(*skeleton));
+            }
+        }
+        for (const auto* child : node.children) {
+            collectSkeletons(*child, skeletons);
         }
     }
-    
-    if (nodeStack.size() != 1) {
-        throw TemplateParseError("Unclosed tags in template");
+}
+
+const Expression* ExpressionMap::find(std::string_view name) const {
+    auto it = std::lower_bound(begin(), end(), name,
+        [](const ExpressionEntry& entry, std::string_view key) { return entry.name < key; });
+    return it != end() && it->name == name ? &it->expr : nullptr;
+}
+
+const Expression& ExpressionMap::at(std::string_view name) const {
+    if (const auto* expr = find(name)) {
+        return *expr;
     }
-    
-    return root;
+    throw std::out_of_range("ExpressionMap::at: " + std::string(name));
 }
 
-std::string TemplateParser::generateCode(std::shared_ptr<TemplateNode> ast) {
-    return generateNodeCode(ast);
+// Nœuds, tableaux et copie du source occupent environ 10 fois la taille du
+// template : un seul bloc dans la plupart des cas
+TemplateAst::TemplateAst(std::size_t sourceSize)
+    : arena_(sourceSize * 10 + 1024) {}
+
+void TemplateAst::setAttribute(TemplateNode& node, std::string_view name, std::string_view value) {
+    SmallVector<ExpressionEntry, 8> entries;
+    for (const auto& entry : node.attributes) {
+        entries.push_back(entry);
+    }
+    Expression expr{ExpressionType::TEXT, arena_.copyString(value), {}, {}};
+    insertEntry(entries, arena_.copyString(name), expr);
+    node.attributes = ExpressionMap(arena_.copyArray(entries.data(), entries.size()), entries.size());
 }
 
-std::string TemplateParser::generateNodeCode(std::shared_ptr<TemplateNode> node) {
-    std::stringstream ss;
+TemplateAst TemplateParser::parse(std::string_view template_content) {
+    TemplateAst ast(template_content.size());
+    Arena& arena = ast.arena_;
     
-    switch (node->type) {
-        case TemplateNode::Type::ELEMENT: {
-            ss << "h(\"" << node->tag << "\", ";
-            
-            // Génère les props (attributs + directives)
-            ss << "{\n";
-            
-            // Attributs normaux
-            ss << generateAttributesCode(node->attributes);
+    // Les vues des nœuds désignent cette copie : l'AST ne dépend pas de la
+    // durée de vie de l'appelant
+    std::string_view source = arena.copyString(template_content);
+    
+    auto createNode = [&](TemplateNode::Type type, const TemplateToken& token) {
+        auto* node = arena.create<TemplateNode>();
+        node->type = type;
+        node->location = token.location;
+        ++ast.nodeCount_;
+        return node;
+    };
+    
+    // Enfants des éléments ouverts, empilés : ceux d'un élément sont copiés
+    // d'un bloc dans l'arène à sa fermeture
+    struct OpenElement {
+        TemplateNode* node;
+        std::size_t firstChild;
+    };
+    SmallVector<OpenElement, 32> openElements;
+    SmallVector<TemplateNode*, 128> pendingChildren;
+    
+    auto closeElement = [&]() {
+        auto open = openElements.back();
+        openElements.pop_back();
+        std::size_t count = pendingChildren.size() - open.firstChild;
+        open.node->children = {arena.copyArray(pendingChildren.data() + open.firstChild, count), count};
+        pendingChildren.resize(open.firstChild);
+    };
+    
+    ast.root_ = arena.create<TemplateNode>();
+    ast.root_->type = TemplateNode::Type::ELEMENT;
+    ast.root_->tag = "template";
+    ++ast.nodeCount_;
+    openElements.push_back({ast.root_, 0});
+    
+    TemplateTokenizer tokenizer(source);
+    EntryList attributes;
+    EntryList directives;
+    
+    for (auto token = tokenizer.next();
+         token.type != TemplateToken::Type::END;
+         token = tokenizer.next()) {
+        switch (token.type) {
+            case TemplateToken::Type::TEXT: {
+                auto* node = createNode(TemplateNode::Type::TEXT, token);
+                node->content = token.value;
+                pendingChildren.push_back(node);
+                break;
+            }
             
-            // Directives
-            if (!node->directives.empty()) {
-                if (!node->attributes.empty()) ss << ",\n";
-                ss << generateDirectivesCode(node->directives);
+            case TemplateToken::Type::INTERPOLATION: {
+                auto* node = createNode(TemplateNode::Type::EXPRESSION, token);
+                node->content = token.value;
+                pendingChildren.push_back(node);
+                break;
             }
             
-            ss << "}";
+            case TemplateToken::Type::CLOSE_TAG: {
+                if (openElements.size() == 1 || openElements.back().node->tag != token.value) {
+                    throw TemplateParseError(formatLocation(token.location) +
+                        "Mismatched closing tag: " + std::string(token.value));
+                }
+                closeElement();
+                break;
+            }
             
-            // Génère les enfants
-            if (!node->children.empty()) {
-                ss << ", {\n";
-                for (size_t i = 0; i < node->children.size(); ++i) {
-                    if (i > 0) ss << ",\n";
-                    ss << generateNodeCode(node->children[i]);
+            case TemplateToken::Type::OPEN_TAG: {
+                auto* node = createNode(TemplateNode::Type::ELEMENT, token);
+                node->tag = token.value;
+                
+                // Parse les attributs
+                attributes.clear();
+                directives.clear();
+                TemplateAttribute attribute;
+                while (tokenizer.nextAttribute(token, attribute)) {
+                    addAttribute(arena, attributes, directives, attribute);
+                }
+                node->attributes = ExpressionMap(arena.copyArray(attributes.data(), attributes.size()),
+                                                 attributes.size());
+                node->directives = ExpressionMap(arena.copyArray(directives.data(), directives.size()),
+                                                 directives.size());
+                
+                pendingChildren.push_back(node);
+                
+                // Si ce n'est pas un tag auto-fermant, l'ajoute à la pile
+                if (!token.selfClosing && !isVoidTag(token.value)) {
+                    openElements.push_back({node, pendingChildren.size()});
                 }
-                ss << "}";
+                break;
             }
             
-            ss << ")";
-            break;
+            case TemplateToken::Type::END:
+                break;
         }
-        
-        case TemplateNode::Type::TEXT:
-            ss << "createTextVNode(\"" << escapeString(node->content) << "\")";
-            break;
-            
-        case TemplateNode::Type::EXPRESSION:
-            ss << "createTextVNode(toString(" << node->content << "))";
-            break;
     }
     
-    return ss.str();
+    if (openElements.size() != 1) {
+        throw TemplateParseError(formatLocation(openElements.back().node->location) +
+            "Unclosed tags in template");
+    }
+    closeElement();
+    
+    return ast;
+}
+
+std::string TemplateParser::generateCode(const TemplateNode& root) {
+    return RenderCodeGenerator().generateBody(root);
 }
 
-std::string TemplateParser::generateAttributesCode(
-    const std::unordered_map<std::string, Expression>& attrs) {
+std::string TemplateParser::generateRenderFunction(const TemplateNode& root,
+                                                   const std::string& className) {
     std::stringstream ss;
-    bool first = true;
-    
-    for (const auto& [name, expr] : attrs) {
-        if (!first) ss << ",\n";
-        first = false;
-        
-        ss << "\"" << name << "\": ";
-        if (expr.type == ExpressionType::TEXT) {
-            ss << "\"" << escapeString(expr.content) << "\"";
+    ss << "std::shared_ptr<cppvue::VNode> " << className << "::render() {\n";
+    ss << generateCode(root);
+    ss << "}\n";
+    return ss.str();
+}
+
+bool TemplateParser::isComponentTag(std::string_view tag) {
+    return !tag.empty() && (std::isupper(static_cast<unsigned char>(tag[0])) ||
+                            tag.find('-') != std::string_view::npos);
+}
+
+std::string TemplateParser::componentClassName(std::string_view tag) {
+    std::string name;
+    bool upper = true;
+    for (char c : tag) {
+        if (c == '-') {
+            upper = true;
         } else {
-            ss << generateExpressionCode(expr);
+            name += upper ? static_cast<char>(std::toupper(static_cast<unsigned char>(c))) : c;
+            upper = false;
         }
     }
-    
-    return ss.str();
+    return name;
 }
 
-std::string TemplateParser::generateDirectivesCode(
-    const std::unordered_map<std::string, Expression>& dirs) {
-    std::stringstream ss;
-    bool first = true;
+std::vector<ChildGroup> TemplateParser::renderedChildren(const TemplateNode& node) {
+    std::vector<ChildGroup> groups;
+    std::size_t runStart = 0;
+    bool runIsBlank = true;
     
-    for (const auto& [name, expr] : dirs) {
-        if (!first) ss << ",\n";
-        first = false;
-        
-        if (expr.type == ExpressionType::DIRECTIVE) {
-            ss << "\"c-" << name << "\": ";
-        } else if (expr.type == ExpressionType::EVENT) {
-            ss << "\"@" << expr.arg << "\": ";
-        } else if (expr.type == ExpressionType::BINDING) {
-            ss << "\":" << expr.arg << "\": ";
+    auto flushText = [&](std::size_t end) {
+        if (end > runStart && !runIsBlank) {
+            groups.push_back(node.children.subspan(runStart, end - runStart));
         }
-        
-        ss << generateExpressionCode(expr);
+        runIsBlank = true;
+    };
+    
+    for (std::size_t i = 0; i < node.children.size(); ++i) {
+        const auto* child = node.children[i];
+        if (child->type == TemplateNode::Type::ELEMENT) {
+            flushText(i);
+            groups.push_back(node.children.subspan(i, 1));
+            runStart = i + 1;
+        } else if (child->type == TemplateNode::Type::EXPRESSION || !isBlank(child->content)) {
+            runIsBlank = false;
+        }
+    }
+    flushText(node.children.size());
+    
+    return groups;
+}
+
+std::string_view TemplateParser::modelProperty(const TemplateNode& node) {
+    const auto* type = node.attributes.find("type");
+    if (type != nullptr && (type->content == "checkbox" || type->content == "radio")) {
+        return "checked";
+    }
+    return "value";
+}
+
+std::optional<StaticSkeleton> TemplateParser::analyzeStaticSkeleton(const TemplateNode& node) {
+    if (node.type != TemplateNode::Type::ELEMENT || node.directives.count("for") == 0) {
+        return std::nullopt;
+    }
+    
+    StaticSkeleton skeleton;
+    std::vector<int> path;
+    std::string signature;
+    if (!collectSkeleton(node, path, true, signature, skeleton.slots)) {
+        return std::nullopt;
     }
     
+    skeleton.hash = fnv1a(signature);
+    return skeleton;
+}
+
+std::string TemplateParser::templateVariableName(const StaticSkeleton& skeleton) {
+    std::stringstream ss;
+    ss << "cppvueTemplate_" << std::hex << skeleton.hash;
     return ss.str();
 }
 
-std::string TemplateParser::generateExpressionCode(const Expression& expr) {
-    switch (expr.type) {
-        case ExpressionType::INTERPOLATION:
-        case ExpressionType::BINDING:
-            return expr.content;
-            
-        case ExpressionType::DIRECTIVE:
-            return "DirectiveBinding{\"" + expr.content + "\", \"" + 
-                   expr.arg + "\", \"" + expr.modifiers + "\"}";
-            
-        case ExpressionType::EVENT:
-            return "EventBinding{\"" + expr.content + "\", \"" + 
-                   expr.modifiers + "\"}";
+std::string TemplateParser::generateTemplateRegistrations(const TemplateNode& root) {
+    std::vector<StaticSkeleton> skeletons;
+    collectSkeletons(root, skeletons);
+    
+    std::stringstream ss;
+    for (const auto& skeleton : skeletons) {
+        // Garde : en build unity, deux composants de la même unité peuvent
+        // enregistrer le même squelette
+        ss << "#ifndef CPPVUE_TEMPLATE_" << std::hex << skeleton.hash << "\n"
+           << "#define CPPVUE_TEMPLATE_" << skeleton.hash << std::dec << "\n";
+        ss << "static const int " << templateVariableName(skeleton)
+           << " = cppvue::TemplateRegistry::instance().registerTemplate(0x"
+           << std::hex << skeleton.hash << std::dec << "ULL, {";
+        
+        for (std::size_t i = 0; i < skeleton.slots.size(); ++i) {
+            const auto& slot = skeleton.slots[i];
+            if (i > 0) ss << ", ";
             
-        default:
-            return "\"" + escapeString(expr.content) + "\"";
+            ss << "{{";
+            for (std::size_t j = 0; j < slot.path.size(); ++j) {
+                if (j > 0) ss << ", ";
+                ss << slot.path[j];
+            }
+            ss << "}, {";
+            for (std::size_t j = 0; j < slot.dynamicProps.size(); ++j) {
+                if (j > 0) ss << ", ";
+                ss << "\"" << escapeString(slot.dynamicProps[j]) << "\"";
+            }
+            ss << "}, " << (slot.dynamicText ? "true" : "false") << "}";
+        }
+        
+        ss << "});\n#endif\n";
     }
+    
+    return ss.str();
 }
 
 } // namespace cppvue::compiler
@@ -1,14 +1,19 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
-#include <unordered_map>
-#include <memory>
+#include <optional>
+#include <span>
+#include <cstdint>
+#include <stdexcept>
+#include "arena.hpp"
+#include "template_tokenizer.hpp"
 
 namespace cppvue::compiler {
 
 // Types d'expressions dans le template
-enum class ExpressionType {
+enum class ExpressionType : std::uint8_t {
     TEXT,           // Texte simple
     INTERPOLATION,  // {{ expression }}
     DIRECTIVE,      // c-if, c-for, etc.
@@ -16,73 +21,139 @@ enum class ExpressionType {
     EVENT,          // @event ou c-on:event
 };
 
-// Structure pour représenter une expression
+// Structure pour représenter une expression ; les vues pointent dans le
+// source du template (ou dans l'arène de l'AST)
 struct Expression {
     ExpressionType type;
-    std::string content;
-    std::string arg;        // Pour les directives/bindings/events
-    std::string modifiers;  // Pour les events
+    std::string_view content;
+    std::string_view arg;        // Pour les directives/bindings/events
+    std::string_view modifiers;  // Pour les events
 };
 
-// Structure pour représenter un nœud dans l'AST
+struct ExpressionEntry {
+    std::string_view name;
+    Expression expr;
+};
+
+// Attributs ou directives d'un élément : tableau trié par nom dans l'arène de
+// l'AST, recherche dichotomique (quelques entrées par élément)
+class ExpressionMap {
+public:
+    ExpressionMap() = default;
+    ExpressionMap(const ExpressionEntry* data, std::size_t size)
+        : data_(data), size_(static_cast<std::uint32_t>(size)) {}
+    
+    const ExpressionEntry* begin() const { return data_; }
+    const ExpressionEntry* end() const { return data_ + size_; }
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    const Expression* find(std::string_view name) const;
+    std::size_t count(std::string_view name) const { return find(name) ? 1 : 0; }
+
+    // std::out_of_range si absent
+    const Expression& at(std::string_view name) const;
+
+private:
+    const ExpressionEntry* data_ = nullptr;
+    std::uint32_t size_ = 0;
+};
+
+// Structure pour représenter un nœud dans l'AST. Alloué dans l'arène de son
+// TemplateAst et jamais détruit individuellement : trivialement destructible.
 struct TemplateNode {
-    enum class Type {
+    enum class Type : std::uint8_t {
         ELEMENT,
         TEXT,
         EXPRESSION
     };
     
     Type type;
-    std::string tag;        // Pour les éléments
-    std::string content;    // Pour le texte/expressions
-    
-    std::vector<std::shared_ptr<TemplateNode>> children;
-    std::unordered_map<std::string, Expression> attributes;
-    std::unordered_map<std::string, Expression> directives;
-    
-    // Constructeurs helpers
-    static std::shared_ptr<TemplateNode> createElement(const std::string& tag) {
-        auto node = std::make_shared<TemplateNode>();
-        node->type = Type::ELEMENT;
-        node->tag = tag;
-        return node;
-    }
-    
-    static std::shared_ptr<TemplateNode> createText(const std::string& content) {
-        auto node = std::make_shared<TemplateNode>();
-        node->type = Type::TEXT;
-        node->content = content;
-        return node;
-    }
-    
-    static std::shared_ptr<TemplateNode> createExpression(const std::string& content) {
-        auto node = std::make_shared<TemplateNode>();
-        node->type = Type::EXPRESSION;
-        node->content = content;
-        return node;
-    }
+    SourceLocation location;    // Position dans le template source
+    std::string_view tag;       // Pour les éléments
+    std::string_view content;   // Pour le texte/expressions
+    
+    std::span<TemplateNode* const> children;
+    ExpressionMap attributes;
+    ExpressionMap directives;
 };
 
+// AST d'un template : nœuds, tableaux d'enfants et d'attributs, et une copie
+// du source que les vues désignent, tous dans une seule arène.
+// Déplaçable ; les nœuds restent à la même adresse.
+class TemplateAst {
+public:
+    const TemplateNode& root() const { return *root_; }
+    TemplateNode& root() { return *root_; }
+    
+    // Ajoute ou remplace un attribut statique (nom et valeur copiés dans l'arène)
+    void setAttribute(TemplateNode& node, std::string_view name, std::string_view value);
+    
+    std::size_t nodeCount() const { return nodeCount_; }
+    
+    // Mémoire réservée par l'arène
+    std::size_t memoryUsage() const { return arena_.bytesReserved(); }
+    std::size_t bytesUsed() const { return arena_.bytesUsed(); }
+
+private:
+    friend class TemplateParser;
+    
+    explicit TemplateAst(std::size_t sourceSize);
+    
+    Arena arena_;
+    TemplateNode* root_ = nullptr;
+    std::size_t nodeCount_ = 0;
+};
+
+// Emplacement dynamique d'un squelette statique (miroir de cppvue::TemplateSlot)
+struct SkeletonSlot {
+    std::vector<int> path;                  // Indices d'enfants rendus depuis la racine
+    std::vector<std::string> dynamicProps;  // Attributs liés
+    bool dynamicText = false;               // Texte interpolé
+};
+
+// Squelette statique d'un corps de c-for, enregistré une fois par structure distincte
+struct StaticSkeleton {
+    std::uint64_t hash;
+    std::vector<SkeletonSlot> slots;
+};
+
+// Groupe d'enfants produisant un seul VNode : un élément, ou une suite de
+// texte/interpolations fusionnée en un nœud texte (enfants consécutifs)
+using ChildGroup = std::span<TemplateNode* const>;
+
 // Parser de template
 class TemplateParser {
 public:
     // Parse un template en AST
-    static std::shared_ptr<TemplateNode> parse(const std::string& template_content);
+    static TemplateAst parse(std::string_view template_content);
     
-    // Génère le code C++ à partir de l'AST
-    static std::string generateCode(std::shared_ptr<TemplateNode> ast);
+    // Génère le corps de la fonction de rendu C++ à partir de l'AST
+    static std::string generateCode(const TemplateNode& root);
     
-private:
-    // Helpers pour le parsing
-    static std::vector<std::shared_ptr<TemplateNode>> parseChildren(const std::string& content);
-    static std::unordered_map<std::string, Expression> parseAttributes(const std::string& tag);
-    static Expression parseExpression(const std::string& content);
-    
-    // Helpers pour la génération de code
-    static std::string generateNodeCode(std::shared_ptr<TemplateNode> node);
-    static std::string generateAttributesCode(const std::unordered_map<std::string, Expression>& attrs);
-    static std::string generateDirectivesCode(const std::unordered_map<std::string, Expression>& dirs);
-    static std::string generateExpressionCode(const Expression& expr);
+    // Génère la définition complète de ClassName::render()
+    static std::string generateRenderFunction(const TemplateNode& root,
+                                              const std::string& className);
+    
+    // Tag désignant un composant (PascalCase ou kebab-case) plutôt qu'un élément DOM
+    static bool isComponentTag(std::string_view tag);
+    
+    // Classe C++ d'un tag de composant (todo-item -> TodoItem)
+    static std::string componentClassName(std::string_view tag);
+    
+    // Enfants tels qu'ils deviennent des VNodes (les suites d'espaces sont ignorées)
+    static std::vector<ChildGroup> renderedChildren(const TemplateNode& node);
+    
+    // Propriété DOM liée par c-model : checked pour une case à cocher ou un
+    // bouton radio, value sinon (partagée par le rendu et les squelettes)
+    static std::string_view modelProperty(const TemplateNode& node);
+    
+    // Squelette statique d'un élément c-for (absent si sa structure n'est pas fixe)
+    static std::optional<StaticSkeleton> analyzeStaticSkeleton(const TemplateNode& node);
+    
+    // Déclarations d'enregistrement des squelettes auprès de cppvue::TemplateRegistry
+    static std::string generateTemplateRegistrations(const TemplateNode& root);
+    static std::string templateVariableName(const StaticSkeleton& skeleton);
 };
 
 // Classe pour la gestion des erreurs de parsing
@@ -0,0 +1,287 @@
+#include "template_tokenizer.hpp"
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace cppvue::compiler {
+
+namespace {
+    bool isSpace(char c) {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+    }
+
+    // Recherche d'un caractère (memchr est vectorisé par la libc)
+    const char* findChar(const char* p, const char* end, char c) {
+        auto found = static_cast<const char*>(std::memchr(p, c, end - p));
+        return found ? found : end;
+    }
+
+    // Recherche du premier de trois caractères, 16 octets à la fois quand SSE2 est disponible
+    const char* findAny3(const char* p, const char* end, char a, char b, char c) {
+#if defined(__SSE2__)
+        const __m128i va = _mm_set1_epi8(a);
+        const __m128i vb = _mm_set1_epi8(b);
+        const __m128i vc = _mm_set1_epi8(c);
+        while (end - p >= 16) {
+            __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            __m128i hits = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, va),
+                                                     _mm_cmpeq_epi8(chunk, vb)),
+                                        _mm_cmpeq_epi8(chunk, vc));
+            int mask = _mm_movemask_epi8(hits);
+            if (mask != 0) {
+                return p + __builtin_ctz(static_cast<unsigned>(mask));
+            }
+            p += 16;
+        }
+#endif
+        for (; p < end; ++p) {
+            if (*p == a || *p == b || *p == c) {
+                return p;
+            }
+        }
+        return end;
+    }
+
+    // Recherche d'une paire de caractères identiques ("{{" ou "}}")
+    const char* findPair(const char* p, const char* end, char c) {
+        while (p < end) {
+            p = findChar(p, end, c);
+            if (p + 1 >= end) {
+                return end;
+            }
+            if (p[1] == c) {
+                return p;
+            }
+            ++p;
+        }
+        return end;
+    }
+
+    std::string_view trim(std::string_view str) {
+        while (!str.empty() && isSpace(str.front())) str.remove_prefix(1);
+        while (!str.empty() && isSpace(str.back())) str.remove_suffix(1);
+        return str;
+    }
+}
+
+TemplateTokenizer::TemplateTokenizer(std::string_view source)
+    : source_(source) {}
+
+SourceLocation TemplateTokenizer::locationAt(std::size_t offset) {
+    if (offset < lineOffset_) {
+        lineOffset_ = 0;
+        line_ = 1;
+        lineStart_ = 0;
+    }
+
+    const char* begin = source_.data();
+    const char* p = begin + lineOffset_;
+    const char* target = begin + offset;
+    while ((p = findChar(p, target, '\n')) < target) {
+        ++line_;
+        lineStart_ = static_cast<std::size_t>(p - begin) + 1;
+        ++p;
+    }
+    lineOffset_ = offset;
+
+    return {line_, static_cast<std::uint32_t>(offset - lineStart_ + 1),
+            static_cast<std::uint32_t>(offset)};
+}
+
+std::size_t TemplateTokenizer::findTagStart(std::size_t from) const {
+    const char* begin = source_.data();
+    const char* end = begin + source_.size();
+    const char* p = begin + from;
+    const char* brace = nullptr;
+
+    while (p < end) {
+        const char* lt = findChar(p, end, '<');
+        if (lt == end) {
+            return source_.size();
+        }
+
+        // Un '<' à l'intérieur d'une interpolation ne commence pas un tag
+        if (!brace || brace < p) {
+            brace = findPair(p, end, '{');
+        }
+        if (brace < lt) {
+            const char* close = findPair(brace + 2, end, '}');
+            if (close != end) {
+                p = close + 2;
+                continue;
+            }
+        }
+
+        // Comme pour le HTML, '<' suivi d'un espace ou de '>' reste du texte
+        if (lt + 1 < end && !isSpace(lt[1]) && lt[1] != '>') {
+            return static_cast<std::size_t>(lt - begin);
+        }
+        p = lt + 1;
+    }
+
+    return source_.size();
+}
+
+TemplateToken TemplateTokenizer::next() {
+    while (pos_ < source_.size()) {
+        if (!inText_) {
+            textEnd_ = findTagStart(pos_);
+            if (textEnd_ == pos_) {
+                TemplateToken token = readTag();
+                if (token.type != TemplateToken::Type::END) {
+                    return token;
+                }
+                continue; // Commentaire ignoré
+            }
+            inText_ = true;
+        }
+
+        if (pos_ < textEnd_) {
+            return readText();
+        }
+        inText_ = false;
+    }
+
+    TemplateToken end;
+    end.location = locationAt(source_.size());
+    return end;
+}
+
+TemplateToken TemplateTokenizer::readText() {
+    const char* begin = source_.data();
+    const char* p = begin + pos_;
+    const char* end = begin + textEnd_;
+
+    TemplateToken token;
+    token.location = locationAt(pos_);
+
+    const char* open = findPair(p, end, '{');
+    if (open == p) {
+        const char* close = findPair(p + 2, end, '}');
+        auto expression = close == end ? std::string_view() :
+            trim(std::string_view(p + 2, close - p - 2));
+        if (!expression.empty()) {
+            token.type = TemplateToken::Type::INTERPOLATION;
+            token.value = expression;
+            pos_ = static_cast<std::size_t>(close - begin) + 2;
+            return token;
+        }
+        // Interpolation non fermée ou vide : reste du texte
+        open = findPair(p + 2, end, '{');
+    }
+
+    token.type = TemplateToken::Type::TEXT;
+    token.value = std::string_view(p, open - p);
+    pos_ = static_cast<std::size_t>(open - begin);
+    return token;
+}
+
+TemplateToken TemplateTokenizer::readTag() {
+    const char* begin = source_.data();
+    const char* end = begin + source_.size();
+    const char* p = begin + pos_;
+
+    // Commentaires et déclarations (<!-- -->, <!DOCTYPE>) : ignorés
+    if (p[1] == '!') {
+        const char* close;
+        if (end - p >= 4 && std::memcmp(p, "<!--", 4) == 0) {
+            close = p + 4;
+            while ((close = findChar(close, end, '-')) < end &&
+                   !(end - close >= 3 && std::memcmp(close, "-->", 3) == 0)) {
+                ++close;
+            }
+            close = close < end ? close + 2 : end;
+        } else {
+            close = findChar(p, end, '>');
+        }
+        pos_ = close < end ? static_cast<std::size_t>(close - begin) + 1 : source_.size();
+        return TemplateToken();
+    }
+
+    TemplateToken token;
+    token.location = locationAt(pos_);
+
+    bool closing = p[1] == '/';
+    const char* nameStart = p + 1 + (closing ? 1 : 0);
+
+    // Fin du tag, en ignorant les '>' entre guillemets
+    const char* q = nameStart;
+    while ((q = findAny3(q, end, '>', '"', '\'')) < end && *q != '>') {
+        const char* quoteEnd = findChar(q + 1, end, *q);
+        q = quoteEnd < end ? quoteEnd + 1 : end;
+    }
+    if (q == end) {
+        // Tag jamais fermé : le reste du source est du texte
+        textEnd_ = source_.size();
+        inText_ = true;
+        return readText();
+    }
+
+    const char* tagEnd = q;
+    bool selfClosing = !closing && tagEnd > nameStart && tagEnd[-1] == '/';
+    const char* contentEnd = selfClosing ? tagEnd - 1 : tagEnd;
+
+    const char* nameEnd = nameStart;
+    while (nameEnd < contentEnd && !isSpace(*nameEnd)) {
+        ++nameEnd;
+    }
+
+    token.type = closing ? TemplateToken::Type::CLOSE_TAG : TemplateToken::Type::OPEN_TAG;
+    token.value = std::string_view(nameStart, nameEnd - nameStart);
+    token.attributes = trim(std::string_view(nameEnd, contentEnd - nameEnd));
+    token.selfClosing = selfClosing;
+
+    pos_ = static_cast<std::size_t>(tagEnd - begin) + 1;
+    return token;
+}
+
+bool TemplateTokenizer::nextAttribute(TemplateToken& tag, TemplateAttribute& attribute) {
+    std::string_view& rest = tag.attributes;
+
+    while (!rest.empty() && (isSpace(rest.front()) || rest.front() == '=')) {
+        rest.remove_prefix(1);
+    }
+    if (rest.empty()) {
+        return false;
+    }
+
+    std::size_t nameLength = 0;
+    while (nameLength < rest.size() && !isSpace(rest[nameLength]) && rest[nameLength] != '=') {
+        ++nameLength;
+    }
+
+    attribute = TemplateAttribute();
+    attribute.name = rest.substr(0, nameLength);
+    attribute.location = locationAt(static_cast<std::size_t>(rest.data() - source_.data()));
+    rest.remove_prefix(nameLength);
+
+    // Valeur éventuelle : ="...", ='...' ou non quotée
+    std::size_t cursor = 0;
+    while (cursor < rest.size() && isSpace(rest[cursor])) ++cursor;
+    if (cursor < rest.size() && rest[cursor] == '=') {
+        ++cursor;
+        while (cursor < rest.size() && isSpace(rest[cursor])) ++cursor;
+
+        if (cursor < rest.size() && (rest[cursor] == '"' || rest[cursor] == '\'')) {
+            char quote = rest[cursor];
+            std::size_t close = rest.find(quote, cursor + 1);
+            if (close == std::string_view::npos) {
+                close = rest.size();
+            }
+            attribute.value = rest.substr(cursor + 1, close - cursor - 1);
+            rest.remove_prefix(close < rest.size() ? close + 1 : close);
+        } else {
+            std::size_t valueEnd = cursor;
+            while (valueEnd < rest.size() && !isSpace(rest[valueEnd])) ++valueEnd;
+            attribute.value = rest.substr(cursor, valueEnd - cursor);
+            rest.remove_prefix(valueEnd);
+        }
+        attribute.hasValue = true;
+    }
+
+    return true;
+}
+
+} // namespace cppvue::compiler
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace cppvue::compiler {
+
+// Position d'un token dans le source du template
+struct SourceLocation {
+    std::uint32_t line = 1;
+    std::uint32_t column = 1;
+    std::uint32_t offset = 0;
+};
+
+// Token produit par le tokenizer ; toutes les vues pointent dans le source
+struct TemplateToken {
+    enum class Type {
+        TEXT,           // Texte brut
+        INTERPOLATION,  // {{ expression }} (value = expression sans espaces)
+        OPEN_TAG,       // <tag attrs> ou <tag attrs/>
+        CLOSE_TAG,      // </tag>
+        END             // Fin du source
+    };
+
+    Type type = Type::END;
+    std::string_view value;       // Texte, expression ou nom du tag
+    std::string_view attributes;  // OPEN_TAG : zone brute des attributs
+    bool selfClosing = false;     // OPEN_TAG terminé par />
+    SourceLocation location;
+};
+
+// Attribut lu dans la zone brute d'un OPEN_TAG
+struct TemplateAttribute {
+    std::string_view name;
+    std::string_view value;
+    bool hasValue = false;
+    SourceLocation location;
+};
+
+// Tokenizer à passe unique sur string_view, sans allocation par token.
+// Les recherches de '<', '{{' et des guillemets utilisent memchr / SSE2.
+class TemplateTokenizer {
+public:
+    explicit TemplateTokenizer(std::string_view source);
+
+    // Token suivant (END à la fin du source)
+    TemplateToken next();
+
+    // Consomme le prochain attribut de tag.attributes ; false quand il n'y en a plus
+    bool nextAttribute(TemplateToken& tag, TemplateAttribute& attribute);
+
+    // Position (ligne/colonne) d'un offset du source
+    SourceLocation locationAt(std::size_t offset);
+
+private:
+    // Début du prochain tag (ou commentaire) valide à partir de from
+    std::size_t findTagStart(std::size_t from) const;
+
+    TemplateToken readTag();
+    TemplateToken readText();
+
+    std::string_view source_;
+    std::size_t pos_ = 0;
+    std::size_t textEnd_ = 0;   // Fin du segment de texte courant
+    bool inText_ = false;
+
+    // Suivi incrémental des lignes pour locationAt
+    std::size_t lineOffset_ = 0;
+    std::uint32_t line_ = 1;
+    std::size_t lineStart_ = 0;
+};
+
+} // namespace cppvue::compiler
@@ -0,0 +1,130 @@
+#include "thread_pool.hpp"
+#include <algorithm>
+
+namespace cppvue::compiler {
+
+namespace {
+    // Index du worker courant (npos hors du pool)
+    thread_local std::size_t currentWorker = static_cast<std::size_t>(-1);
+}
+
+std::size_t ThreadPool::defaultThreadCount() {
+    return std::max<std::size_t>(1, std::thread::hardware_concurrency());
+}
+
+ThreadPool::ThreadPool(std::size_t threads) {
+    if (threads == 0) {
+        threads = defaultThreadCount();
+    }
+
+    for (std::size_t i = 0; i < threads; ++i) {
+        queues_.push_back(std::make_unique<WorkQueue>());
+    }
+    for (std::size_t i = 0; i < threads; ++i) {
+        workers_.emplace_back([this, i]() { workerLoop(i); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(stateMutex_);
+        stopping_ = true;
+    }
+    workAvailable_.notify_all();
+
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void ThreadPool::submit(std::function<void()> task) {
+    // Une tâche soumise depuis un worker reste locale, sinon répartition circulaire
+    std::size_t index = currentWorker < queues_.size() ?
+        currentWorker : nextQueue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+
+    // Compteurs avant la file : un worker peut prendre la tâche dès qu'elle y
+    // est, son décrément ne doit jamais précéder l'incrément
+    {
+        std::lock_guard<std::mutex> lock(stateMutex_);
+        ++queued_;
+        ++pending_;
+    }
+    {
+        std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+        queues_[index]->tasks.push_back(std::move(task));
+    }
+    workAvailable_.notify_one();
+}
+
+void ThreadPool::wait() {
+    std::unique_lock<std::mutex> lock(stateMutex_);
+    allDone_.wait(lock, [this]() { return pending_ == 0; });
+
+    if (firstError_) {
+        auto error = firstError_;
+        firstError_ = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+bool ThreadPool::popLocal(std::size_t index, std::function<void()>& task) {
+    auto& queue = *queues_[index];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) {
+        return false;
+    }
+    task = std::move(queue.tasks.back());
+    queue.tasks.pop_back();
+    return true;
+}
+
+bool ThreadPool::steal(std::size_t index, std::function<void()>& task) {
+    for (std::size_t offset = 1; offset < queues_.size(); ++offset) {
+        auto& queue = *queues_[(index + offset) % queues_.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.tasks.empty()) {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::workerLoop(std::size_t index) {
+    currentWorker = index;
+
+    while (true) {
+        std::function<void()> task;
+        if (popLocal(index, task) || steal(index, task)) {
+            {
+                std::lock_guard<std::mutex> lock(stateMutex_);
+                --queued_;
+            }
+
+            std::exception_ptr error;
+            try {
+                task();
+            } catch (...) {
+                error = std::current_exception();
+            }
+
+            std::lock_guard<std::mutex> lock(stateMutex_);
+            if (error && !firstError_) {
+                firstError_ = error;
+            }
+            if (--pending_ == 0) {
+                allDone_.notify_all();
+            }
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(stateMutex_);
+        workAvailable_.wait(lock, [this]() { return stopping_ || queued_ > 0; });
+        if (stopping_ && queued_ == 0) {
+            return;
+        }
+    }
+}
+
+} // namespace cppvue::compiler
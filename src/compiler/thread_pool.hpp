@@ -0,0 +1,60 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace cppvue::compiler {
+
+// Pool de threads à vol de tâches : chaque worker a sa propre file, dépile
+// ses tâches par la fin et vole les plus anciennes des autres files quand
+// la sienne est vide.
+class ThreadPool {
+public:
+    // threads = 0 : un worker par cœur
+    explicit ThreadPool(std::size_t threads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    void submit(std::function<void()> task);
+
+    // Attend la fin de toutes les tâches soumises ; relance la première exception
+    void wait();
+
+    std::size_t size() const { return workers_.size(); }
+
+    static std::size_t defaultThreadCount();
+
+private:
+    struct WorkQueue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    void workerLoop(std::size_t index);
+    bool popLocal(std::size_t index, std::function<void()>& task);
+    bool steal(std::size_t index, std::function<void()>& task);
+
+    std::vector<std::unique_ptr<WorkQueue>> queues_;
+    std::vector<std::thread> workers_;
+    std::atomic<std::size_t> nextQueue_{0};
+
+    std::mutex stateMutex_;
+    std::condition_variable workAvailable_;
+    std::condition_variable allDone_;
+    std::size_t queued_ = 0;    // Tâches en file, pas encore prises
+    std::size_t pending_ = 0;   // Tâches soumises et non terminées
+    bool stopping_ = false;
+    std::exception_ptr firstError_;
+};
+
+} // namespace cppvue::compiler
@@ -38,4 +38,71 @@ std::shared_ptr<VNode> Component::h(
     return VNode::create(tag, {}, {}, text);
 }
 
+void Component::setSlot(const std::string& name, std::shared_ptr<Slot> slot) {
+    slots_[name] = std::move(slot);
+}
+
+std::shared_ptr<Slot> Component::getSlot(const std::string& name) const {
+    auto it = slots_.find(name);
+    return it != slots_.end() ? it->second : nullptr;
+}
+
+void Component::setEventHandler(const std::string& event, std::function<void(std::any)> handler) {
+    eventHandlers_[event] = std::move(handler);
+}
+
+void Component::expose(const std::string& name,
+                       std::function<Value()> getter,
+                       std::function<void(Value)> setter) {
+    variables_[SymbolTable::instance().intern(name)] = {std::move(getter), std::move(setter)};
+}
+
+Value Component::getVariable(Symbol name) const {
+    auto it = variables_.find(name);
+    if (it == variables_.end()) {
+        throw std::runtime_error("Variable not found: " + SymbolTable::instance().name(name));
+    }
+    return it->second.getter();
+}
+
+void Component::setVariable(Symbol name, Value value) {
+    auto it = variables_.find(name);
+    if (it == variables_.end()) {
+        throw std::runtime_error("Variable not found: " + SymbolTable::instance().name(name));
+    }
+    if (!it->second.setter) {
+        throw std::runtime_error("Read-only variable: " + SymbolTable::instance().name(name));
+    }
+    it->second.setter(std::move(value));
+}
+
+Value Component::evaluateExpressionValue(const std::string& source,
+                                         const std::unordered_map<std::string, std::any>& locals) {
+    Expression expression = ExpressionCache::instance().get(source);
+    if (locals.empty()) {
+        return expression.evaluateValue(scope_);
+    }
+    scope_.pushScope();
+    for (const auto& [name, value] : locals) {
+        scope_.setVariable(name, Value::fromAny(value));
+    }
+    try {
+        Value value = expression.evaluateValue(scope_);
+        scope_.popScope();
+        return value;
+    } catch (...) {
+        scope_.popScope();
+        throw;
+    }
+}
+
+std::shared_ptr<Component> Component::findChild(const std::string& key) const {
+    auto it = children_.find(key);
+    return it != children_.end() ? it->second : nullptr;
+}
+
+void Component::adoptChild(const std::string& key, std::shared_ptr<Component> child) {
+    children_[key] = std::move(child);
+}
+
 } // namespace cppvue
@@ -3,10 +3,12 @@
 #include "reactive.hpp"
 #include "lifecycle.hpp"
 #include "directives.hpp"
+#include "expression_cache.hpp"
 #include <string>
 #include <vector>
 #include <unordered_map>
 #include <memory>
+#include <optional>
 #include <any>
 
 namespace cppvue {
@@ -22,8 +24,13 @@ public:
     std::unordered_map<std::string, std::string> props;
     std::vector<std::shared_ptr<VNode>> children;
     std::string textContent;
+    std::optional<std::string> innerHTML;  // Contenu HTML brut de c-html, à la place des enfants
     std::vector<Directive> directives;
+    std::unordered_map<std::string, std::any> events;  // std::function<void(void*)> par nom d'événement
+    std::unordered_map<std::string, std::shared_ptr<bool>> onceFired;  // Handlers .once déjà déclenchés
     std::weak_ptr<Component> component;
+    std::string key;      // :key du template, vide si absent
+    int templateId = -1;  // Squelette statique partagé (voir TemplateRegistry), -1 si aucun
     
     static std::shared_ptr<VNode> create(
         const std::string& tag,
@@ -96,10 +103,46 @@ public:
     void emit(const std::string& event, Args&&... args) {
         auto handler = eventHandlers_.find(event);
         if (handler != eventHandlers_.end()) {
-            handler->second(std::forward<Args>(args)...);
+            if constexpr (sizeof...(Args) == 0) {
+                handler->second(std::any());
+            } else {
+                handler->second(std::forward<Args>(args)...);
+            }
         }
     }
     
+    void setEventHandler(const std::string& event, std::function<void(std::any)> handler);
+    
+    // Variables accessibles aux expressions dynamiques (c-if, :prop, @event...) ;
+    // sans setter, la variable est en lecture seule
+    void expose(const std::string& name,
+                std::function<Value()> getter,
+                std::function<void(Value)> setter = {});
+    Value getVariable(Symbol name) const;
+    void setVariable(Symbol name, Value value);
+    
+    // Évaluation d'une expression du template (compilée une fois par ExpressionCache)
+    // dans le scope courant ; locals forment un scope temporaire ($event...)
+    template<typename T>
+    T evaluateExpression(const std::string& source,
+                         const std::unordered_map<std::string, std::any>& locals = {}) {
+        Value value = evaluateExpressionValue(source, locals);
+        if constexpr (!std::is_void_v<T>) {
+            return value.as<T>();
+        }
+    }
+    Value evaluateExpressionValue(const std::string& source,
+                                  const std::unordered_map<std::string, std::any>& locals = {});
+    
+    // Scopes des expressions (alias des c-for)
+    void pushScope() { scope_.pushScope(); }
+    void popScope() { scope_.popScope(); }
+    void setScopeVariable(const std::string& name, Value value) { scope_.setVariable(name, std::move(value)); }
+    
+    // Composants enfants créés par le rendu, conservés par clé entre deux rendus
+    std::shared_ptr<Component> findChild(const std::string& key) const;
+    void adoptChild(const std::string& key, std::shared_ptr<Component> child);
+    
     // Utilitaire pour créer des nœuds virtuels
     static std::shared_ptr<VNode> h(
         const std::string& tag,
@@ -138,6 +181,14 @@ private:
     std::unordered_map<std::string, std::any> refs_;
     std::unordered_map<std::string, std::shared_ptr<Slot>> slots_;
     std::unordered_map<std::string, std::function<void(std::any)>> eventHandlers_;
+    std::unordered_map<std::string, std::shared_ptr<Component>> children_;
+    
+    struct ExposedVariable {
+        std::function<Value()> getter;
+        std::function<void(Value)> setter;
+    };
+    std::unordered_map<Symbol, ExposedVariable> variables_;
+    EvaluationContext scope_{this};
     
     friend class LifecycleWatchdog;
 };
@@ -154,4 +205,9 @@ std::shared_ptr<Component> createComponent(Args&&... args) {
 // Fonction pour obtenir l'instance de composant courante
 Component* getCurrentInstance();
 
+// Déclare une prop dans la classe d'un composant : accesseur name() lisant la
+// valeur passée par le parent ; cvuec y résout les références du template
+#define CPPVUE_PROP(Type, name) \
+    Type name() const { return getProp<Type>(#name); }
+
 } // namespace cppvue
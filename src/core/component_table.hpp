@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+namespace cppvue {
+
+class Component;
+
+// Table des composants d'un projet, générée par cvuec (component_registry.hpp) :
+// nom -> identifiant -> fabrique, par un hachage parfait calculé au build.
+// Tout est constexpr : ni allocation ni initialisation dynamique au démarrage,
+// et les identifiants entiers passent tels quels par le bridge wasm.
+struct ComponentTable {
+    using Factory = std::shared_ptr<Component> (*)();
+    static constexpr std::uint32_t INVALID_ID = 0xFFFFFFFFu;
+
+    const std::string_view* names = nullptr;      // Par identifiant (ordre alphabétique)
+    const Factory* factories = nullptr;           // Par identifiant
+    const std::int32_t* displacements = nullptr;  // Par seau : graine, ou -(case + 1) pour un seau d'un nom
+    const std::uint32_t* slots = nullptr;         // Case -> identifiant
+    std::uint32_t size = 0;
+
+    // FNV-1a 64 bits dont la base dépend de la graine, suivi d'un mélange final.
+    // Le build (compiler/perfect_hash) calcule les graines avec cette fonction.
+    static constexpr std::uint64_t hash(std::string_view key, std::uint64_t seed) noexcept {
+        std::uint64_t h = 0xcbf29ce484222325ULL ^ (seed * 0x9E3779B97F4A7C15ULL);
+        for (char c : key) {
+            h ^= static_cast<unsigned char>(c);
+            h *= 0x100000001b3ULL;
+        }
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+    // Identifiant de name, INVALID_ID si inconnu ; deux hachages au plus
+    constexpr std::uint32_t idOf(std::string_view name) const noexcept {
+        if (size == 0) {
+            return INVALID_ID;
+        }
+        std::int32_t displacement = displacements[hash(name, 0) % size];
+        std::uint32_t slot = displacement < 0
+            ? static_cast<std::uint32_t>(-(displacement + 1))
+            : static_cast<std::uint32_t>(hash(name, static_cast<std::uint64_t>(displacement)) % size);
+        std::uint32_t id = slots[slot];
+        return names[id] == name ? id : INVALID_ID;
+    }
+
+    constexpr std::string_view nameOf(std::uint32_t id) const noexcept {
+        return id < size ? names[id] : std::string_view{};
+    }
+
+    std::shared_ptr<Component> create(std::uint32_t id) const {
+        return id < size ? factories[id]() : nullptr;
+    }
+
+    std::shared_ptr<Component> create(std::string_view name) const {
+        return create(idOf(name));
+    }
+
+    // Table du programme, installée par le loadComponents() généré
+    static void install(const ComponentTable* table) noexcept { active_ = table; }
+    static const ComponentTable* active() noexcept { return active_; }
+
+private:
+    static constinit inline const ComponentTable* active_ = nullptr;
+};
+
+} // namespace cppvue
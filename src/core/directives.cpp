@@ -94,19 +94,22 @@ void DirectiveHandler::handleIf(const Directive& directive,
 void DirectiveHandler::handleFor(const Directive& directive,
                                std::shared_ptr<VNode> node,
                                Component* component) {
-    // Parse l'expression "item in items"
-    std::regex forRegex("(\\w+)\\s+in\\s+(\\w+)");
+    // Parse l'expression "item in items" (items : expression quelconque)
+    static const std::regex forRegex("(\\w+)\\s+in\\s+(.+)");
     std::smatch matches;
     if (std::regex_match(directive.value, matches, forRegex)) {
         std::string itemName = matches[1].str();
         std::string itemsName = matches[2].str();
         
         // Obtient la collection à itérer
-        auto items = component->evaluateExpression<std::vector<std::any>>(itemsName);
+        auto items = component->evaluateExpression<Value>(itemsName);
+        if (items.type() != Value::Type::ARRAY) {
+            return;
+        }
         
         // Crée un nœud pour chaque élément
         std::vector<std::shared_ptr<VNode>> newNodes;
-        for (const auto& item : items) {
+        for (const auto& item : items.array()) {
             // Crée une copie du template
             auto clone = std::make_shared<VNode>(*node);
             
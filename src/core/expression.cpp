@@ -1,88 +1,932 @@
 #include "expression.hpp"
 #include "component.hpp"
 #include <cctype>
-#include <sstream>
-#include <stack>
+#include <cmath>
+#include <cstring>
+#include <optional>
+#include <stdexcept>
 
 namespace cppvue {
 
-std::any EvaluationContext::getVariable(const std::string& name) const {
+Value EvaluationContext::getVariable(const std::string& name) const {
+    return getVariable(SymbolTable::instance().intern(name));
+}
+
+Value EvaluationContext::getVariable(Symbol symbol) const {
     // Cherche dans les scopes du plus récent au plus ancien
-    for (auto it = scopes_.rbegin(); it != scopes_.rend(); ++it) {
-        auto var = it->find(name);
-        if (var != it->end()) {
-            return var->second;
+    for (auto it = bindings_.rbegin(); it != bindings_.rend(); ++it) {
+        if (it->symbol == symbol) {
+            return it->value;
         }
     }
-    
+
     // Si non trouvé dans les scopes, cherche dans le composant
     if (component_) {
-        return component_->getVariable(name);
+        return component_->getVariable(symbol);
     }
-    
-    throw std::runtime_error("Variable not found: " + name);
+
+    throw std::runtime_error("Variable not found: " + SymbolTable::instance().name(symbol));
 }
 
-void EvaluationContext::setVariable(const std::string& name, std::any value) {
-    if (scopes_.empty()) {
+void EvaluationContext::setVariable(const std::string& name, Value value) {
+    setVariable(SymbolTable::instance().intern(name), std::move(value));
+}
+
+void EvaluationContext::setVariable(Symbol symbol, Value value) {
+    if (scopeStarts_.empty()) {
         pushScope();
     }
-    scopes_.top()[name] = std::move(value);
+    // Déjà définie dans le scope courant (itération suivante d'un c-for) : remplacée sur place
+    for (std::size_t i = scopeStarts_.back(); i < bindings_.size(); ++i) {
+        if (bindings_[i].symbol == symbol) {
+            bindings_[i].value = std::move(value);
+            return;
+        }
+    }
+    bindings_.push_back({symbol, std::move(value)});
+}
+
+void EvaluationContext::assignVariable(Symbol symbol, Value value) const {
+    if (!component_) {
+        throw std::runtime_error("Cannot assign to " + SymbolTable::instance().name(symbol) +
+                                 " without a component");
+    }
+    component_->setVariable(symbol, std::move(value));
 }
 
 void EvaluationContext::pushScope() {
-    scopes_.push({});
+    scopeStarts_.push_back(bindings_.size());
 }
 
 void EvaluationContext::popScope() {
-    if (!scopes_.empty()) {
-        scopes_.pop();
+    if (!scopeStarts_.empty()) {
+        bindings_.erase(bindings_.begin() + static_cast<std::ptrdiff_t>(scopeStarts_.back()), bindings_.end());
+        scopeStarts_.pop_back();
+    }
+}
+
+namespace {
+    using Kind = ExpressionAst::Kind;
+    using Op = ExpressionAst::Op;
+    using OpCode = ExpressionProgram::OpCode;
+
+    // Registres alloués sur la pile pour les expressions courantes
+    constexpr std::size_t INLINE_REGISTERS = 16;
+    // Les registres de variables déjà lus sont suivis dans un masque de 64 bits
+    constexpr std::size_t MAX_VARIABLES = 64;
+
+    OpCode opcodeFor(Op op) {
+        switch (op) {
+            case Op::ADD: return OpCode::ADD;
+            case Op::SUB: return OpCode::SUB;
+            case Op::MUL: return OpCode::MUL;
+            case Op::DIV: return OpCode::DIV;
+            case Op::MOD: return OpCode::MOD;
+            case Op::EQ: return OpCode::EQ;
+            case Op::NE: return OpCode::NE;
+            case Op::LT: return OpCode::LT;
+            case Op::LE: return OpCode::LE;
+            case Op::GT: return OpCode::GT;
+            case Op::GE: return OpCode::GE;
+            case Op::NOT: return OpCode::NOT;
+            case Op::NEG: return OpCode::NEG;
+            default: return OpCode::PLUS;
+        }
+    }
+
+    Value unary(OpCode code, const Value& operand) {
+        switch (code) {
+            case OpCode::NOT: return !operand.toBoolean();
+            case OpCode::NEG:
+                if (operand.isInteger()) return -operand.toInteger();
+                return -operand.toNumber();
+            default:
+                if (operand.isInteger()) return operand;
+                return operand.toNumber();
+        }
+    }
+
+    Value binary(OpCode code, const Value& left, const Value& right) {
+        switch (code) {
+            case OpCode::EQ: return left.equals(right);
+            case OpCode::NE: return !left.equals(right);
+            case OpCode::LT:
+            case OpCode::LE:
+            case OpCode::GT:
+            case OpCode::GE: {
+                int order;
+                if (left.isString() && right.isString()) {
+                    order = left.string().compare(right.string());
+                } else {
+                    double a = left.toNumber();
+                    double b = right.toNumber();
+                    if (a != a || b != b) {
+                        return false;  // NaN
+                    }
+                    order = a < b ? -1 : a > b ? 1 : 0;
+                }
+                switch (code) {
+                    case OpCode::LT: return order < 0;
+                    case OpCode::LE: return order <= 0;
+                    case OpCode::GT: return order > 0;
+                    default: return order >= 0;
+                }
+            }
+            default:
+                break;
+        }
+
+        if (code == OpCode::ADD && (left.isString() || right.isString())) {
+            return left.toString() + right.toString();
+        }
+        // Entiers conservés tant que le résultat est exact (/ donne toujours un double)
+        if (left.isInteger() && right.isInteger() && code != OpCode::DIV) {
+            std::int64_t a = left.toInteger();
+            std::int64_t b = right.toInteger();
+            switch (code) {
+                case OpCode::ADD: return a + b;
+                case OpCode::SUB: return a - b;
+                case OpCode::MUL: return a * b;
+                case OpCode::MOD:
+                    if (b == 0) return std::nan("");
+                    return a % b;
+                default: break;
+            }
+        }
+        double a = left.toNumber();
+        double b = right.toNumber();
+        switch (code) {
+            case OpCode::ADD: return a + b;
+            case OpCode::SUB: return a - b;
+            case OpCode::MUL: return a * b;
+            case OpCode::DIV: return a / b;
+            case OpCode::MOD: return std::fmod(a, b);
+            default: throw std::runtime_error("Invalid arithmetic operator");
+        }
+    }
+
+    // Exécution d'une fonction du programme (0 : corps de l'expression)
+    Value run(const std::shared_ptr<const ExpressionProgram>& program, std::uint16_t index,
+              const EvaluationContext& context) {
+        const auto& function = program->functions[index];
+
+        Value inlineRegisters[INLINE_REGISTERS];
+        std::vector<Value> heapRegisters;
+        Value* registers = inlineRegisters;
+        if (function.registerCount > INLINE_REGISTERS) {
+            heapRegisters.resize(function.registerCount);
+            registers = heapRegisters.data();
+        }
+        std::uint64_t resolved = 0;  // Bit i : variables[i] déjà lue dans le registre i
+
+        const ExpressionProgram::Instruction* code = function.code.data();
+        for (std::size_t pc = 0;;) {
+            const auto& instruction = code[pc++];
+            switch (instruction.code) {
+                case OpCode::LOAD_CONST:
+                    registers[instruction.a] = program->constants[instruction.b];
+                    break;
+
+                case OpCode::RESOLVE: {
+                    std::uint64_t bit = std::uint64_t{1} << instruction.b;
+                    if (!(resolved & bit)) {
+                        registers[instruction.b] = context.getVariable(function.variables[instruction.b]);
+                        resolved |= bit;
+                    }
+                    break;
+                }
+
+                case OpCode::MOVE:
+                    registers[instruction.a] = registers[instruction.b];
+                    break;
+
+                case OpCode::MEMBER:
+                    registers[instruction.a] = registers[instruction.b].member(program->names[instruction.c]);
+                    break;
+
+                case OpCode::INDEX:
+                    registers[instruction.a] = registers[instruction.b].index(registers[instruction.c]);
+                    break;
+
+                case OpCode::CALL: {
+                    const Value& callee = registers[instruction.b];
+                    if (callee.type() != Value::Type::FUNCTION) {
+                        throw std::runtime_error("Expression value is not a function");
+                    }
+                    std::uint16_t count = program->operands[instruction.c];
+                    std::vector<Value> arguments;
+                    arguments.reserve(count);
+                    for (std::uint16_t i = 0; i < count; ++i) {
+                        arguments.push_back(registers[program->operands[instruction.c + 1 + i]]);
+                    }
+                    registers[instruction.a] = callee.function()(arguments);
+                    break;
+                }
+
+                case OpCode::CLOSURE: {
+                    // Les paramètres forment un scope au-dessus du contexte de création
+                    Value::Function closure =
+                        [program, body = instruction.b, context](const std::vector<Value>& arguments) {
+                            EvaluationContext scope = context;
+                            scope.pushScope();
+                            const auto& parameters = program->functions[body].parameters;
+                            for (std::size_t i = 0; i < parameters.size(); ++i) {
+                                scope.setVariable(parameters[i], i < arguments.size() ? arguments[i] : Value());
+                            }
+                            return run(program, body, scope);
+                        };
+                    registers[instruction.a] = std::move(closure);
+                    break;
+                }
+
+                case OpCode::STORE:
+                    context.assignVariable(function.variables[instruction.b], registers[instruction.a]);
+                    registers[instruction.b] = registers[instruction.a];
+                    resolved |= std::uint64_t{1} << instruction.b;
+                    break;
+
+                case OpCode::NOT:
+                case OpCode::NEG:
+                case OpCode::PLUS:
+                    registers[instruction.a] = unary(instruction.code, registers[instruction.b]);
+                    break;
+
+                case OpCode::JUMP:
+                    pc = instruction.b;
+                    break;
+
+                case OpCode::JUMP_IF_FALSE:
+                    if (!registers[instruction.a].toBoolean()) {
+                        pc = instruction.b;
+                    }
+                    break;
+
+                case OpCode::JUMP_IF_TRUE:
+                    if (registers[instruction.a].toBoolean()) {
+                        pc = instruction.b;
+                    }
+                    break;
+
+                case OpCode::RETURN:
+                    return std::move(registers[instruction.a]);
+
+                default:
+                    registers[instruction.a] =
+                        binary(instruction.code, registers[instruction.b], registers[instruction.c]);
+                    break;
+            }
+        }
     }
 }
 
+Expression Expression::constant(Value value) {
+    auto program = std::make_shared<ExpressionProgram>();
+    program->constants.push_back(std::move(value));
+    auto& function = program->functions.emplace_back();
+    function.code = {{OpCode::LOAD_CONST, 0, 0}, {OpCode::RETURN, 0}};
+    function.registerCount = 1;
+    return Expression(std::move(program));
+}
+
+Expression Expression::identifier(const std::string& name) {
+    auto program = std::make_shared<ExpressionProgram>();
+    auto& function = program->functions.emplace_back();
+    function.variables.push_back(SymbolTable::instance().intern(name));
+    function.code = {{OpCode::RESOLVE, 0, 0}, {OpCode::RETURN, 0}};
+    function.registerCount = 1;
+    return Expression(std::move(program));
+}
+
+Value Expression::evaluateValue(const EvaluationContext& context) const {
+    return run(program_, 0, context);
+}
+
+namespace {
+    // Littéral numérique : entier 64 bits, flottant s'il a une partie décimale
+    // ou dépasse la plage des entiers (comme les nombres JavaScript)
+    Value numberLiteral(const std::string& text) {
+        try {
+            if (text.find('.') == std::string::npos) {
+                try {
+                    return Value(static_cast<std::int64_t>(std::stoll(text)));
+                } catch (const std::out_of_range&) {
+                }
+            }
+            return Value(std::stod(text));
+        } catch (const std::logic_error&) {
+            throw std::runtime_error("Invalid number in expression: " + text);
+        }
+    }
+}
+
+// Pratt : chaque opérateur infixe a une force de liaison ; parseExpression(minPower)
+// consomme les opérateurs plus forts que minPower
+class ExpressionParser::Parser {
+public:
+    explicit Parser(const std::vector<Token>& tokens)
+        : tokens_(tokens), ast_(std::make_shared<ExpressionAst>()) {}
+
+    std::shared_ptr<ExpressionAst> parse() {
+        ast_->root = parseExpression(0);
+        if (position_ < tokens_.size()) {
+            throw std::runtime_error("Unexpected token in expression: " + tokens_[position_].value);
+        }
+        return ast_;
+    }
+
+private:
+    // Forces de liaison, de la plus faible à la plus forte
+    enum Power {
+        NONE = 0,
+        ASSIGNMENT = 1,   // associatif à droite
+        TERNARY = 2,      // associatif à droite
+        OR = 3,
+        AND = 4,
+        EQUALITY = 5,
+        RELATIONAL = 6,
+        ADDITIVE = 7,
+        MULTIPLICATIVE = 8,
+        PREFIX = 9,
+        POSTFIX = 10      // ., [], ()
+    };
+
+    std::uint32_t parseExpression(int minPower) {
+        std::uint32_t left = parsePrefix();
+        while (position_ < tokens_.size()) {
+            int power = infixPower(tokens_[position_]);
+            if (power <= minPower) {
+                break;
+            }
+            left = parseInfix(left, power);
+        }
+        return left;
+    }
+
+    std::uint32_t parsePrefix() {
+        if (position_ >= tokens_.size()) {
+            throw std::runtime_error("Unexpected end of expression");
+        }
+        const Token& token = tokens_[position_++];
+        switch (token.type) {
+            case Token::Type::NUMBER:
+                return constant(numberLiteral(token.value));
+
+            case Token::Type::STRING:
+                return constant(token.value);
+
+            case Token::Type::IDENTIFIER:
+                if (token.value == "true") return constant(true);
+                if (token.value == "false") return constant(false);
+                if (token.value == "null" || token.value == "undefined") return constant(Value());
+                if (isOperator("=>")) {
+                    return parseArrow({name(token.value)});
+                }
+                return add({Kind::IDENTIFIER, Op::NONE, name(token.value)});
+
+            case Token::Type::OPERATOR: {
+                Op op = token.value == "!" ? Op::NOT
+                      : token.value == "-" ? Op::NEG
+                      : token.value == "+" ? Op::PLUS
+                      : Op::NONE;
+                if (op == Op::NONE) {
+                    break;
+                }
+                std::uint32_t operand = parseExpression(PREFIX);
+                return add({Kind::UNARY, op, operand});
+            }
+
+            case Token::Type::PUNCTUATION:
+                if (token.value == "(") {
+                    if (std::vector<std::uint32_t> parameters; scanArrowParameters(parameters)) {
+                        return parseArrow(parameters);
+                    }
+                    std::uint32_t inner = parseExpression(NONE);
+                    expect(")");
+                    return inner;
+                }
+                break;
+        }
+        throw std::runtime_error("Unexpected token in expression: " + token.value);
+    }
+
+    std::uint32_t parseInfix(std::uint32_t left, int power) {
+        const Token& token = tokens_[position_++];
+        const std::string& value = token.value;
+
+        if (token.type == Token::Type::PUNCTUATION) {
+            if (value == ".") {
+                if (position_ >= tokens_.size() || tokens_[position_].type != Token::Type::IDENTIFIER) {
+                    throw std::runtime_error("Expected property name after '.'");
+                }
+                return add({Kind::MEMBER, Op::NONE, left, name(tokens_[position_++].value)});
+            }
+            if (value == "[") {
+                std::uint32_t key = parseExpression(NONE);
+                expect("]");
+                return add({Kind::INDEX, Op::NONE, left, key});
+            }
+            // Appel : les arguments sont rangés à la suite dans lists
+            std::vector<std::uint32_t> arguments;
+            if (!isPunctuation(")")) {
+                do {
+                    arguments.push_back(parseExpression(NONE));
+                } while (accept(","));
+            }
+            expect(")");
+            return add({Kind::CALL, Op::NONE, left, list(arguments),
+                        static_cast<std::uint32_t>(arguments.size())});
+        }
+
+        if (value == "?") {
+            std::uint32_t consequent = parseExpression(NONE);
+            expect(":");
+            std::uint32_t alternate = parseExpression(TERNARY - 1);
+            return add({Kind::CONDITIONAL, Op::NONE, left, consequent, alternate});
+        }
+
+        if (power == ASSIGNMENT) {
+            if (ast_->nodes[left].kind != Kind::IDENTIFIER) {
+                throw std::runtime_error("Invalid assignment target");
+            }
+            Op op = value == "+=" ? Op::ADD
+                  : value == "-=" ? Op::SUB
+                  : value == "*=" ? Op::MUL
+                  : value == "/=" ? Op::DIV
+                  : Op::NONE;
+            std::uint32_t right = parseExpression(ASSIGNMENT - 1);
+            return add({Kind::ASSIGN, op, left, right});
+        }
+
+        std::uint32_t right = parseExpression(power);
+        if (value == "&&" || value == "||") {
+            return add({Kind::LOGICAL, value == "&&" ? Op::AND : Op::OR, left, right});
+        }
+        return add({Kind::BINARY, binaryOp(value), left, right});
+    }
+
+    // Après "(" : (a, b) => ... ? Les paramètres ne sont consommés que si c'est le cas.
+    bool scanArrowParameters(std::vector<std::uint32_t>& parameters) {
+        std::size_t scan = position_;
+        std::vector<std::string> names;
+        while (scan < tokens_.size() && tokens_[scan].type == Token::Type::IDENTIFIER) {
+            names.push_back(tokens_[scan++].value);
+            if (scan < tokens_.size() && tokens_[scan].value == "," &&
+                tokens_[scan].type == Token::Type::PUNCTUATION) {
+                ++scan;
+            } else {
+                break;
+            }
+        }
+        if (scan + 1 >= tokens_.size() || tokens_[scan].value != ")" || tokens_[scan + 1].value != "=>") {
+            return false;
+        }
+        for (const auto& parameter : names) {
+            parameters.push_back(name(parameter));
+        }
+        position_ = scan + 1;
+        return true;
+    }
+
+    std::uint32_t parseArrow(const std::vector<std::uint32_t>& parameters) {
+        expect("=>");
+        std::uint32_t body = parseExpression(NONE);
+        return add({Kind::ARROW, Op::NONE, body, list(parameters),
+                    static_cast<std::uint32_t>(parameters.size())});
+    }
+
+    static int infixPower(const Token& token) {
+        const std::string& value = token.value;
+        if (token.type == Token::Type::PUNCTUATION) {
+            return value == "." || value == "[" || value == "(" ? POSTFIX : NONE;
+        }
+        if (token.type != Token::Type::OPERATOR) return NONE;
+        if (value == "=" || value == "+=" || value == "-=" || value == "*=" || value == "/=") return ASSIGNMENT;
+        if (value == "?") return TERNARY;
+        if (value == "||") return OR;
+        if (value == "&&") return AND;
+        if (value == "==" || value == "!=" || value == "===" || value == "!==") return EQUALITY;
+        if (value == "<" || value == "<=" || value == ">" || value == ">=") return RELATIONAL;
+        if (value == "+" || value == "-") return ADDITIVE;
+        if (value == "*" || value == "/" || value == "%") return MULTIPLICATIVE;
+        return NONE;
+    }
+
+    static Op binaryOp(const std::string& value) {
+        if (value == "+") return Op::ADD;
+        if (value == "-") return Op::SUB;
+        if (value == "*") return Op::MUL;
+        if (value == "/") return Op::DIV;
+        if (value == "%") return Op::MOD;
+        if (value == "==" || value == "===") return Op::EQ;
+        if (value == "!=" || value == "!==") return Op::NE;
+        if (value == "<") return Op::LT;
+        if (value == "<=") return Op::LE;
+        if (value == ">") return Op::GT;
+        return Op::GE;
+    }
+
+    std::uint32_t add(ExpressionAst::Node node) {
+        ast_->nodes.push_back(node);
+        return static_cast<std::uint32_t>(ast_->nodes.size() - 1);
+    }
+
+    std::uint32_t constant(Value value) {
+        ast_->constants.push_back(std::move(value));
+        return add({Kind::CONSTANT, Op::NONE, static_cast<std::uint32_t>(ast_->constants.size() - 1)});
+    }
+
+    // Noms dédoublonnés : un identifiant répété partage son entrée
+    std::uint32_t name(const std::string& value) {
+        auto [it, inserted] = nameIndices_.try_emplace(value, static_cast<std::uint32_t>(ast_->names.size()));
+        if (inserted) {
+            ast_->names.push_back(value);
+        }
+        return it->second;
+    }
+
+    std::uint32_t list(const std::vector<std::uint32_t>& items) {
+        auto first = static_cast<std::uint32_t>(ast_->lists.size());
+        ast_->lists.insert(ast_->lists.end(), items.begin(), items.end());
+        return first;
+    }
+
+    bool isOperator(const char* value) const {
+        return position_ < tokens_.size() && tokens_[position_].type == Token::Type::OPERATOR &&
+               tokens_[position_].value == value;
+    }
+
+    bool isPunctuation(const char* value) const {
+        return position_ < tokens_.size() && tokens_[position_].type == Token::Type::PUNCTUATION &&
+               tokens_[position_].value == value;
+    }
+
+    bool accept(const char* value) {
+        if (position_ < tokens_.size() && tokens_[position_].value == value &&
+            tokens_[position_].type != Token::Type::STRING) {
+            ++position_;
+            return true;
+        }
+        return false;
+    }
+
+    void expect(const char* value) {
+        if (!accept(value)) {
+            throw std::runtime_error(std::string("Expected '") + value + "' in expression");
+        }
+    }
+
+    const std::vector<Token>& tokens_;
+    std::size_t position_ = 0;
+    std::shared_ptr<ExpressionAst> ast_;
+    std::unordered_map<std::string, std::uint32_t> nameIndices_;
+};
+
+// AST -> bytecode. Chaque fonction (corps, flèches) a ses registres : d'abord
+// un par identifiant distinct, puis les temporaires, réutilisés d'une
+// sous-expression à l'autre.
+class ExpressionParser::Compiler {
+public:
+    explicit Compiler(const ExpressionAst& ast)
+        : ast_(ast), program_(std::make_shared<ExpressionProgram>()) {}
+
+    std::shared_ptr<ExpressionProgram> compile() {
+        compileFunction(ast_.root, {});
+        return program_;
+    }
+
+private:
+    struct FunctionState {
+        ExpressionProgram::Function function;
+        std::unordered_map<Symbol, std::uint16_t> registers;  // Variable -> registre
+        std::uint16_t next = 0;                               // Premier temporaire libre
+    };
+
+    std::uint16_t compileFunction(std::uint32_t body, std::vector<Symbol> parameters) {
+        auto index = static_cast<std::uint16_t>(program_->functions.size());
+        program_->functions.emplace_back();
+
+        FunctionState state;
+        state.function.parameters = std::move(parameters);
+        FunctionState* enclosing = current_;
+        current_ = &state;
+
+        collectVariables(body);
+        if (state.function.variables.size() > MAX_VARIABLES) {
+            throw std::runtime_error("Expression uses too many variables");
+        }
+        state.next = static_cast<std::uint16_t>(state.function.variables.size());
+        state.function.registerCount = state.next;
+
+        std::uint16_t result = compileNode(body);
+        emit(OpCode::RETURN, result);
+
+        current_ = enclosing;
+        program_->functions[index] = std::move(state.function);
+        return index;
+    }
+
+    // Identifiants lus ou affectés par la fonction, hors corps des flèches imbriquées
+    void collectVariables(std::uint32_t index) {
+        const auto& node = ast_.nodes[index];
+        switch (node.kind) {
+            case Kind::CONSTANT:
+            case Kind::ARROW:
+                return;
+            case Kind::IDENTIFIER: {
+                Symbol symbol = SymbolTable::instance().intern(ast_.names[node.a]);
+                auto next = static_cast<std::uint16_t>(current_->function.variables.size());
+                if (current_->registers.try_emplace(symbol, next).second) {
+                    current_->function.variables.push_back(symbol);
+                }
+                return;
+            }
+            case Kind::MEMBER:
+            case Kind::UNARY:
+                collectVariables(node.a);
+                return;
+            case Kind::CALL:
+                collectVariables(node.a);
+                for (std::uint32_t i = 0; i < node.c; ++i) {
+                    collectVariables(ast_.lists[node.b + i]);
+                }
+                return;
+            case Kind::CONDITIONAL:
+                collectVariables(node.c);
+                [[fallthrough]];
+            default:
+                collectVariables(node.a);
+                collectVariables(node.b);
+                return;
+        }
+    }
+
+    // Valeur de la sous-expression si elle ne dépend d'aucune variable
+    std::optional<Value> fold(std::uint32_t index) const {
+        const auto& node = ast_.nodes[index];
+        switch (node.kind) {
+            case Kind::CONSTANT:
+                return ast_.constants[node.a];
+            case Kind::UNARY:
+                if (auto operand = fold(node.a)) {
+                    return unary(opcodeFor(node.op), *operand);
+                }
+                return std::nullopt;
+            case Kind::BINARY: {
+                auto left = fold(node.a);
+                auto right = left ? fold(node.b) : std::nullopt;
+                if (!right) {
+                    return std::nullopt;
+                }
+                try {
+                    return binary(opcodeFor(node.op), *left, *right);
+                } catch (const std::runtime_error&) {
+                    return std::nullopt;  // L'erreur sera levée à l'évaluation
+                }
+            }
+            case Kind::LOGICAL: {
+                auto left = fold(node.a);
+                if (!left) {
+                    return std::nullopt;
+                }
+                if (left->toBoolean() == (node.op == Op::OR)) {
+                    return left;
+                }
+                return fold(node.b);
+            }
+            case Kind::CONDITIONAL:
+                if (auto condition = fold(node.a)) {
+                    return fold(condition->toBoolean() ? node.b : node.c);
+                }
+                return std::nullopt;
+            default:
+                return std::nullopt;
+        }
+    }
+
+    // Compile le nœud et renvoie le registre qui contient sa valeur
+    // (registre de variable pour un identifiant : en lecture seule)
+    std::uint16_t compileNode(std::uint32_t index) {
+        const auto& node = ast_.nodes[index];
+
+        if (node.kind != Kind::CONSTANT && node.kind != Kind::IDENTIFIER) {
+            if (auto value = fold(index)) {
+                return loadConstant(std::move(*value));
+            }
+        }
+
+        std::uint16_t mark = current_->next;
+        switch (node.kind) {
+            case Kind::CONSTANT:
+                return loadConstant(ast_.constants[node.a]);
+
+            case Kind::IDENTIFIER:
+                return resolve(ast_.names[node.a]);
+
+            case Kind::MEMBER: {
+                std::uint16_t object = compileNode(node.a);
+                current_->next = mark;
+                std::uint16_t result = allocate();
+                emit(OpCode::MEMBER, result, object, name(ast_.names[node.b]));
+                return result;
+            }
+
+            case Kind::INDEX:
+            case Kind::BINARY: {
+                std::uint16_t left = compileNode(node.a);
+                std::uint16_t right = compileNode(node.b);
+                current_->next = mark;
+                std::uint16_t result = allocate();
+                emit(node.kind == Kind::INDEX ? OpCode::INDEX : opcodeFor(node.op), result, left, right);
+                return result;
+            }
+
+            case Kind::UNARY: {
+                std::uint16_t operand = compileNode(node.a);
+                current_->next = mark;
+                std::uint16_t result = allocate();
+                emit(opcodeFor(node.op), result, operand);
+                return result;
+            }
+
+            case Kind::CALL: {
+                std::uint16_t callee = compileNode(node.a);
+                std::vector<std::uint16_t> arguments;
+                for (std::uint32_t i = 0; i < node.c; ++i) {
+                    arguments.push_back(compileNode(ast_.lists[node.b + i]));
+                }
+                auto first = static_cast<std::uint16_t>(program_->operands.size());
+                program_->operands.push_back(static_cast<std::uint16_t>(arguments.size()));
+                program_->operands.insert(program_->operands.end(), arguments.begin(), arguments.end());
+                current_->next = mark;
+                std::uint16_t result = allocate();
+                emit(OpCode::CALL, result, callee, first);
+                return result;
+            }
+
+            case Kind::LOGICAL: {
+                // Un opérande gauche constant qui ne décide pas est simplement omis
+                if (fold(node.a)) {
+                    return compileNode(node.b);
+                }
+                std::uint16_t result = allocate();
+                compileInto(node.a, result);
+                std::size_t jump = emit(node.op == Op::AND ? OpCode::JUMP_IF_FALSE : OpCode::JUMP_IF_TRUE, result);
+                compileInto(node.b, result);
+                patch(jump);
+                return result;
+            }
+
+            case Kind::CONDITIONAL: {
+                if (auto condition = fold(node.a)) {
+                    return compileNode(condition->toBoolean() ? node.b : node.c);
+                }
+                std::uint16_t result = allocate();
+                std::uint16_t condition = compileNode(node.a);
+                std::size_t toAlternate = emit(OpCode::JUMP_IF_FALSE, condition);
+                compileInto(node.b, result);
+                std::size_t toEnd = emit(OpCode::JUMP);
+                patch(toAlternate);
+                compileInto(node.c, result);
+                patch(toEnd);
+                current_->next = static_cast<std::uint16_t>(result + 1);
+                return result;
+            }
+
+            case Kind::ARROW: {
+                std::vector<Symbol> parameters;
+                for (std::uint32_t i = 0; i < node.c; ++i) {
+                    parameters.push_back(SymbolTable::instance().intern(ast_.names[ast_.lists[node.b + i]]));
+                }
+                std::uint16_t function = compileFunction(node.a, std::move(parameters));
+                std::uint16_t result = allocate();
+                emit(OpCode::CLOSURE, result, function);
+                return result;
+            }
+
+            case Kind::ASSIGN: {
+                std::uint16_t value = compileNode(node.b);
+                std::uint16_t variable = current_->registers.at(
+                    SymbolTable::instance().intern(ast_.names[ast_.nodes[node.a].a]));
+                if (node.op != Op::NONE) {
+                    resolve(ast_.names[ast_.nodes[node.a].a]);
+                    std::uint16_t combined = allocate();
+                    emit(opcodeFor(node.op), combined, variable, value);
+                    value = combined;
+                }
+                emit(OpCode::STORE, value, variable);
+                current_->next = mark;
+                return variable;
+            }
+        }
+        throw std::runtime_error("Invalid expression node");
+    }
+
+    void compileInto(std::uint32_t index, std::uint16_t target) {
+        std::uint16_t mark = current_->next;
+        std::uint16_t result = compileNode(index);
+        if (result != target) {
+            emit(OpCode::MOVE, target, result);
+        }
+        current_->next = mark;
+    }
+
+    std::uint16_t resolve(const std::string& variable) {
+        std::uint16_t reg = current_->registers.at(SymbolTable::instance().intern(variable));
+        emit(OpCode::RESOLVE, 0, reg);
+        return reg;
+    }
+
+    std::uint16_t loadConstant(Value value) {
+        auto index = static_cast<std::uint16_t>(program_->constants.size());
+        program_->constants.push_back(std::move(value));
+        std::uint16_t result = allocate();
+        emit(OpCode::LOAD_CONST, result, index);
+        return result;
+    }
+
+    std::uint16_t name(const std::string& value) {
+        auto [it, inserted] = names_.try_emplace(value, static_cast<std::uint16_t>(program_->names.size()));
+        if (inserted) {
+            program_->names.push_back(value);
+        }
+        return it->second;
+    }
+
+    std::uint16_t allocate() {
+        if (current_->next == UINT16_MAX) {
+            throw std::runtime_error("Expression too complex");
+        }
+        std::uint16_t reg = current_->next++;
+        if (current_->next > current_->function.registerCount) {
+            current_->function.registerCount = current_->next;
+        }
+        return reg;
+    }
+
+    std::size_t emit(OpCode code, std::uint16_t a = 0, std::uint16_t b = 0, std::uint16_t c = 0) {
+        current_->function.code.push_back({code, a, b, c});
+        return current_->function.code.size() - 1;
+    }
+
+    // Saut émis plus tôt : cible = instruction suivante
+    void patch(std::size_t jump) {
+        current_->function.code[jump].b = static_cast<std::uint16_t>(current_->function.code.size());
+    }
+
+    const ExpressionAst& ast_;
+    std::shared_ptr<ExpressionProgram> program_;
+    std::unordered_map<std::string, std::uint16_t> names_;
+    FunctionState* current_ = nullptr;
+};
+
 std::vector<ExpressionParser::Token> ExpressionParser::tokenize(const std::string& input) {
+    // Opérateurs de plusieurs caractères, du plus long au plus court
+    static const char* const longOperators[] = {
+        "===", "!==", "==", "!=", "<=", ">=", "&&", "||", "=>", "+=", "-=", "*=", "/="
+    };
+
     std::vector<Token> tokens;
     std::string::const_iterator it = input.begin();
-    
+
     while (it != input.end()) {
         // Ignore les espaces
         if (std::isspace(*it)) {
             ++it;
             continue;
         }
-        
+
         // Nombres
         if (std::isdigit(*it)) {
             std::string number;
             bool hasDecimal = false;
-            
-            while (it != input.end() && 
+
+            while (it != input.end() &&
                    (std::isdigit(*it) || (!hasDecimal && *it == '.'))) {
                 if (*it == '.') hasDecimal = true;
                 number += *it++;
             }
-            
+
             tokens.push_back({Token::Type::NUMBER, number});
             continue;
         }
-        
+
         // Identifiants
         if (isIdentifierStart(*it)) {
             std::string identifier;
-            
+
             while (it != input.end() && isIdentifierPart(*it)) {
                 identifier += *it++;
             }
-            
+
             tokens.push_back({Token::Type::IDENTIFIER, identifier});
             continue;
         }
-        
+
         // Chaînes de caractères
         if (*it == '"' || *it == '\'') {
             char quote = *it++;
             std::string str;
-            
+
             while (it != input.end() && *it != quote) {
                 if (*it == '\\' && (it + 1) != input.end()) {
                     ++it;
@@ -97,34 +941,39 @@ std::vector<ExpressionParser::Token> ExpressionParser::tokenize(const std::strin
                 }
                 ++it;
             }
-            
+
             if (it != input.end()) ++it; // Skip closing quote
             tokens.push_back({Token::Type::STRING, str});
             continue;
         }
-        
-        // Opérateurs
+
+        // Opérateurs : plus longue correspondance (a>-1 donne > puis -)
         if (isOperator(*it)) {
-            std::string op;
-            while (it != input.end() && isOperator(*it)) {
-                op += *it++;
+            std::string op(1, *it);
+            for (const char* candidate : longOperators) {
+                std::size_t length = std::strlen(candidate);
+                if (input.compare(static_cast<std::size_t>(it - input.begin()), length, candidate) == 0) {
+                    op = candidate;
+                    break;
+                }
             }
+            it += static_cast<std::ptrdiff_t>(op.size());
             tokens.push_back({Token::Type::OPERATOR, op});
             continue;
         }
-        
+
         // Ponctuation
         if (isPunctuation(*it)) {
             tokens.push_back({Token::Type::PUNCTUATION, std::string(1, *it)});
             ++it;
             continue;
         }
-        
+
         // Caractère invalide
-        throw std::runtime_error("Invalid character in expression: " + 
+        throw std::runtime_error("Invalid character in expression: " +
                                std::string(1, *it));
     }
-    
+
     return tokens;
 }
 
@@ -137,44 +986,19 @@ Expression ExpressionParser::parseTokens(const std::vector<Token>& tokens) {
     if (tokens.empty()) {
         return Expression::literal(std::string());
     }
-    
-    // Pour l'instant, on gère uniquement les expressions simples
-    if (tokens.size() == 1) {
-        const auto& token = tokens[0];
-        switch (token.type) {
-            case Token::Type::IDENTIFIER:
-                return Expression::identifier(token.value);
-                
-            case Token::Type::NUMBER:
-                if (token.value.find('.') != std::string::npos) {
-                    return Expression::literal(std::stod(token.value));
-                } else {
-                    return Expression::literal(std::stoi(token.value));
-                }
-                
-            case Token::Type::STRING:
-                return Expression::literal(token.value);
-                
-            default:
-                throw std::runtime_error("Unexpected token type");
-        }
-    }
-    
-    // TODO: Implémenter le parsing d'expressions plus complexes
-    // (opérateurs, appels de méthodes, etc.)
-    
-    throw std::runtime_error("Complex expressions not yet implemented");
+    auto ast = Parser(tokens).parse();
+    return Expression(Compiler(*ast).compile());
 }
 
 bool ExpressionParser::isOperator(char c) {
-    return c == '+' || c == '-' || c == '*' || c == '/' || 
-           c == '=' || c == '!' || c == '<' || c == '>' || 
-           c == '&' || c == '|' || c == '^';
+    return c == '+' || c == '-' || c == '*' || c == '/' || c == '%' ||
+           c == '=' || c == '!' || c == '<' || c == '>' ||
+           c == '&' || c == '|' || c == '^' || c == '?' || c == ':';
 }
 
 bool ExpressionParser::isPunctuation(char c) {
-    return c == '(' || c == ')' || c == '[' || c == ']' || 
-           c == '{' || c == '}' || c == '.' || c == ',' || 
+    return c == '(' || c == ')' || c == '[' || c == ']' ||
+           c == '{' || c == '}' || c == '.' || c == ',' ||
            c == ';';
 }
 
@@ -1,11 +1,13 @@
 #pragma once
 
+#include "value.hpp"
 #include <string>
 #include <unordered_map>
 #include <any>
+#include <cstdint>
 #include <functional>
 #include <memory>
-#include <stack>
+#include <type_traits>
 #include <vector>
 
 namespace cppvue {
@@ -13,66 +15,172 @@ namespace cppvue {
 // Forward declarations
 class Component;
 
-// Classe pour représenter une expression
-class Expression {
-public:
-    // Constructeur pour une expression littérale
-    template<typename T>
-    static Expression literal(T value) {
-        return Expression([value]() -> std::any { return value; });
-    }
-    
-    // Constructeur pour une expression référençant une variable
-    static Expression identifier(const std::string& name) {
-        return Expression([name](const EvaluationContext& ctx) -> std::any {
-            return ctx.getVariable(name);
-        });
-    }
-    
-    // Évalue l'expression dans un contexte donné
-    template<typename T>
-    T evaluate(const EvaluationContext& context = EvaluationContext()) const {
-        return std::any_cast<T>(evaluator_(context));
-    }
-    
-private:
-    using Evaluator = std::function<std::any(const EvaluationContext&)>;
-    
-    explicit Expression(Evaluator evaluator)
-        : evaluator_(std::move(evaluator)) {}
-    
-    Evaluator evaluator_;
-};
+// Valeurs composites manipulées par les expressions
+using ExpressionObject = Value::Object;
+using ExpressionArray = Value::Array;
+using ExpressionFunction = Value::Function;
 
 // Contexte d'évaluation des expressions
 class EvaluationContext {
 public:
     explicit EvaluationContext(Component* component = nullptr)
         : component_(component) {}
-    
+
     // Accès aux variables
-    std::any getVariable(const std::string& name) const;
-    void setVariable(const std::string& name, std::any value);
-    
+    Value getVariable(const std::string& name) const;
+    Value getVariable(Symbol symbol) const;
+    void setVariable(const std::string& name, Value value);
+    void setVariable(Symbol symbol, Value value);
+
+    // Affectation depuis une expression (@click="count = count + 1") : écrit
+    // dans le composant, les variables de scope (alias c-for) sont en lecture seule
+    void assignVariable(Symbol symbol, Value value) const;
+
     // Gestion du scope
     void pushScope();
     void popScope();
-    
+
     // Accès au composant
     Component* component() const { return component_; }
-    
+
 private:
+    struct Binding {
+        Symbol symbol;
+        Value value;
+    };
+
     Component* component_;
-    std::stack<std::unordered_map<std::string, std::any>> scopes_;
-    
-    friend class Expression;
+    // Variables de tous les scopes à la suite, la plus récente en dernier ;
+    // scopeStarts_ donne le début de chaque scope
+    std::vector<Binding> bindings_;
+    std::vector<std::size_t> scopeStarts_;
+};
+
+// AST d'une expression : nœuds contigus, enfants désignés par leur indice.
+// Produit par le parser puis compilé en ExpressionProgram.
+struct ExpressionAst {
+    enum class Kind : std::uint8_t {
+        CONSTANT,     // constants[a]
+        IDENTIFIER,   // names[a]
+        MEMBER,       // a.names[b]
+        INDEX,        // a[b]
+        CALL,         // a(lists[b .. b+c])
+        UNARY,        // op a
+        BINARY,       // a op b
+        LOGICAL,      // a && b, a || b (court-circuit)
+        CONDITIONAL,  // a ? b : c
+        ARROW,        // (names[lists[b .. b+c]]) => a
+        ASSIGN        // a op= b, a identifiant
+    };
+
+    enum class Op : std::uint8_t {
+        NONE,
+        ADD, SUB, MUL, DIV, MOD,
+        EQ, NE, LT, LE, GT, GE,
+        AND, OR,
+        NOT, NEG, PLUS
+    };
+
+    struct Node {
+        Kind kind;
+        Op op = Op::NONE;
+        std::uint32_t a = 0;
+        std::uint32_t b = 0;
+        std::uint32_t c = 0;
+    };
+
+    std::vector<Node> nodes;
+    std::vector<Value> constants;
+    std::vector<std::string> names;
+    std::vector<std::uint32_t> lists;  // Arguments d'appel, paramètres de flèche
+    std::uint32_t root = 0;
+};
+
+// Bytecode à registres d'une expression. Chaque identifiant distinct a son
+// registre (résolu à la première lecture, une fois par évaluation) ; les
+// sous-expressions constantes sont calculées à la compilation.
+struct ExpressionProgram {
+    enum class OpCode : std::uint8_t {
+        LOAD_CONST,     // R[a] = constants[b]
+        RESOLVE,        // R[b] = variable variables[b], si pas encore lue
+        MOVE,           // R[a] = R[b]
+        MEMBER,         // R[a] = R[b].names[c]
+        INDEX,          // R[a] = R[b][R[c]]
+        CALL,           // R[a] = R[b](R[operands[c+1 ..]]), operands[c] arguments
+        CLOSURE,        // R[a] = fonction fléchée functions[b]
+        STORE,          // variables[b] = R[a] (affectation)
+        NOT, NEG, PLUS, // R[a] = op R[b]
+        ADD, SUB, MUL, DIV, MOD,
+        EQ, NE, LT, LE, GT, GE,  // R[a] = R[b] op R[c]
+        JUMP,           // pc = b
+        JUMP_IF_FALSE,  // si !R[a] : pc = b
+        JUMP_IF_TRUE,   // si R[a] : pc = b
+        RETURN          // renvoie R[a]
+    };
+
+    struct Instruction {
+        OpCode code;
+        std::uint16_t a = 0;
+        std::uint16_t b = 0;
+        std::uint16_t c = 0;
+    };
+
+    // Corps principal (functions[0]) ou fonction fléchée
+    struct Function {
+        std::vector<Instruction> code;
+        std::vector<Symbol> variables;   // Registre i <-> variables[i]
+        std::vector<Symbol> parameters;
+        std::uint16_t registerCount = 0;
+    };
+
+    std::vector<Function> functions;
+    std::vector<Value> constants;
+    std::vector<std::string> names;
+    std::vector<std::uint16_t> operands;
+};
+
+// Classe pour représenter une expression
+class Expression {
+public:
+    // Constructeur pour une expression littérale
+    template<typename T>
+    static Expression literal(T value) {
+        return constant(Value::fromAny(std::any(std::move(value))));
+    }
+
+    // Constructeur pour une expression référençant une variable
+    static Expression identifier(const std::string& name);
+
+    // Évalue l'expression dans un contexte donné
+    template<typename T>
+    T evaluate(const EvaluationContext& context = EvaluationContext()) const {
+        if constexpr (std::is_void_v<T>) {
+            evaluateValue(context);
+        } else {
+            return evaluateValue(context).as<T>();
+        }
+    }
+
+    Value evaluateValue(const EvaluationContext& context) const;
+
+    const ExpressionProgram& program() const { return *program_; }
+
+private:
+    explicit Expression(std::shared_ptr<const ExpressionProgram> program)
+        : program_(std::move(program)) {}
+
+    static Expression constant(Value value);
+
+    std::shared_ptr<const ExpressionProgram> program_;
+
+    friend class ExpressionParser;
 };
 
 // Parser d'expressions
 class ExpressionParser {
 public:
     static Expression parse(const std::string& expressionStr);
-    
+
 private:
     struct Token {
         enum class Type {
@@ -82,14 +190,19 @@ private:
             OPERATOR,
             PUNCTUATION
         };
-        
+
         Type type;
         std::string value;
     };
-    
+
+    // Parser à précédence (Pratt) sur la liste de tokens
+    class Parser;
+    // Traduction de l'AST en bytecode
+    class Compiler;
+
     static std::vector<Token> tokenize(const std::string& input);
     static Expression parseTokens(const std::vector<Token>& tokens);
-    
+
     // Helpers pour le parsing
     static bool isOperator(char c);
     static bool isPunctuation(char c);
@@ -0,0 +1,103 @@
+#include "expression_cache.hpp"
+#include <mutex>
+
+namespace cppvue {
+
+ExpressionCache& ExpressionCache::instance() {
+    static ExpressionCache cache;
+    return cache;
+}
+
+Expression ExpressionCache::get(std::string_view source) {
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        auto it = index_.find(source);
+        if (it != index_.end()) {
+            it->second->referenced.store(true, std::memory_order_relaxed);
+            hits_.fetch_add(1, std::memory_order_relaxed);
+            return it->second->expression;
+        }
+    }
+
+    // Compilation hors verrou : deux threads peuvent compiler la même source,
+    // le premier inséré est conservé
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    std::string text(source);
+    Expression expression = ExpressionParser::parse(text);
+    std::size_t bytes = footprint(text, expression.program());
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto it = index_.find(source);
+    if (it != index_.end()) {
+        return it->second->expression;
+    }
+    // Insérée juste derrière l'aiguille : la dernière examinée au prochain tour
+    auto entry = entries_.emplace(clockHand_, std::move(text), expression, bytes);
+    index_.emplace(entry->source, entry);
+    bytes_ += bytes;
+    evict();
+    return expression;
+}
+
+void ExpressionCache::setCapacity(std::size_t bytes) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    capacity_ = bytes;
+    evict();
+}
+
+ExpressionCache::Stats ExpressionCache::stats() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    Stats stats;
+    stats.hits = hits_.load(std::memory_order_relaxed);
+    stats.misses = misses_.load(std::memory_order_relaxed);
+    stats.evictions = evictions_.load(std::memory_order_relaxed);
+    stats.entries = entries_.size();
+    stats.bytes = bytes_;
+    stats.capacity = capacity_;
+    return stats;
+}
+
+void ExpressionCache::clear() {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    index_.clear();
+    entries_.clear();
+    clockHand_ = entries_.end();
+    bytes_ = 0;
+}
+
+std::size_t ExpressionCache::footprint(const std::string& source, const ExpressionProgram& program) {
+    std::size_t bytes = sizeof(Entry) + sizeof(ExpressionProgram) + source.size() +
+                        program.operands.size() * sizeof(std::uint16_t);
+    for (const auto& function : program.functions) {
+        bytes += sizeof(function) +
+                 function.code.size() * sizeof(ExpressionProgram::Instruction) +
+                 (function.variables.size() + function.parameters.size()) * sizeof(Symbol);
+    }
+    for (const auto& constant : program.constants) {
+        bytes += sizeof(Value) + (constant.isString() ? constant.string().size() : 0);
+    }
+    for (const auto& name : program.names) {
+        bytes += sizeof(name) + name.size();
+    }
+    return bytes;
+}
+
+void ExpressionCache::evict() {
+    // Une entrée lue depuis le dernier passage a une seconde chance ;
+    // au plus deux tours complets suffisent à trouver une victime
+    while (bytes_ > capacity_ && !entries_.empty()) {
+        if (clockHand_ == entries_.end()) {
+            clockHand_ = entries_.begin();
+        }
+        if (clockHand_->referenced.exchange(false, std::memory_order_relaxed)) {
+            ++clockHand_;
+            continue;
+        }
+        bytes_ -= clockHand_->bytes;
+        index_.erase(clockHand_->source);
+        clockHand_ = entries_.erase(clockHand_);
+        evictions_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+} // namespace cppvue
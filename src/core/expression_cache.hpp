@@ -0,0 +1,71 @@
+#pragma once
+
+#include "expression.hpp"
+#include <atomic>
+#include <cstddef>
+#include <list>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace cppvue {
+
+// Cache global des expressions compilées, indexé par leur texte source :
+// toutes les instances d'un composant, et toutes les lignes d'un c-for,
+// partagent la même expression. Lectures concurrentes sous verrou partagé ;
+// au-delà de la capacité (octets estimés), éviction par horloge (CLOCK).
+class ExpressionCache {
+public:
+    struct Stats {
+        std::size_t hits = 0;
+        std::size_t misses = 0;
+        std::size_t evictions = 0;
+        std::size_t entries = 0;
+        std::size_t bytes = 0;
+        std::size_t capacity = 0;
+    };
+
+    static ExpressionCache& instance();
+
+    // Expression compilée de source (compilée au premier appel) ;
+    // une erreur de syntaxe est levée à chaque appel et n'est pas mise en cache
+    Expression get(std::string_view source);
+
+    // Capacité en octets estimés (source + bytecode + constantes)
+    void setCapacity(std::size_t bytes);
+
+    Stats stats() const;
+    void clear();
+
+private:
+    ExpressionCache() = default;
+
+    struct Entry {
+        std::string source;
+        Expression expression;
+        std::size_t bytes;
+        mutable std::atomic<bool> referenced{true};  // Lue depuis le dernier passage de l'horloge
+
+        Entry(std::string text, Expression compiled, std::size_t size)
+            : source(std::move(text)), expression(std::move(compiled)), bytes(size) {}
+    };
+
+    static std::size_t footprint(const std::string& source, const ExpressionProgram& program);
+
+    // Sous verrou exclusif : retire des entrées jusqu'à repasser sous la capacité
+    void evict();
+
+    mutable std::shared_mutex mutex_;
+    std::list<Entry> entries_;  // Anneau parcouru par clockHand_
+    std::list<Entry>::iterator clockHand_ = entries_.end();
+    std::unordered_map<std::string_view, std::list<Entry>::iterator> index_;  // Clés dans Entry::source
+    std::size_t bytes_ = 0;
+    std::size_t capacity_ = 4 * 1024 * 1024;
+
+    std::atomic<std::size_t> hits_{0};
+    std::atomic<std::size_t> misses_{0};
+    std::atomic<std::size_t> evictions_{0};
+};
+
+} // namespace cppvue
@@ -0,0 +1,71 @@
+#include "hot_reload.hpp"
+#include "renderer.hpp"
+#include <vector>
+
+namespace cppvue {
+
+// Défini ici et non dans l'en-tête : un module rechargé doit partager
+// l'instance du programme principal au lieu d'en créer une copie
+HotReload& HotReload::instance() {
+    static HotReload hotReload;
+    return hotReload;
+}
+
+bool HotReload::registerLayout(const std::string& component, std::uint64_t scriptHash) {
+    entries_[component].scriptHash = scriptHash;
+    return true;
+}
+
+bool HotReload::registerRender(const std::string& component, std::uint64_t scriptHash, RenderFunction render) {
+    auto it = entries_.find(component);
+    if (it == entries_.end() || it->second.scriptHash != scriptHash) {
+        return false;
+    }
+    it->second.render = std::move(render);
+    it->second.revision++;
+    return true;
+}
+
+std::size_t HotReload::revision(const std::string& component) const {
+    auto it = entries_.find(component);
+    return it != entries_.end() ? it->second.revision : 0;
+}
+
+const HotReload::RenderFunction* HotReload::enter(const std::string& component, Component& instance) {
+    auto& entry = entries_[component];
+
+    // Seules les instances détenues par un shared_ptr peuvent être re-rendues
+    auto& tracked = entry.instances[&instance];
+    if (tracked.expired()) {
+        tracked = instance.weak_from_this();
+    }
+    return entry.render ? &entry.render : nullptr;
+}
+
+std::size_t HotReload::apply(const std::string& component) {
+    auto it = entries_.find(component);
+    if (it == entries_.end()) {
+        return 0;
+    }
+
+    // Copie : un re-rendu peut créer de nouvelles instances du même composant
+    std::vector<std::shared_ptr<Component>> live;
+    auto& instances = it->second.instances;
+    for (auto instance = instances.begin(); instance != instances.end();) {
+        if (auto locked = instance->second.lock()) {
+            live.push_back(std::move(locked));
+            ++instance;
+        } else {
+            instance = instances.erase(instance);
+        }
+    }
+
+    if (renderer_) {
+        for (const auto& instance : live) {
+            renderer_->update(instance);
+        }
+    }
+    return live.size();
+}
+
+} // namespace cppvue
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "component.hpp"
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+// Dans un module rechargé, les rendus générés restent locaux au module :
+// sinon l'éditeur de liens dynamique les résoudrait vers l'ancienne version
+#if defined(CPPVUE_HOT_MODULE)
+#define CPPVUE_HOT_LOCAL __attribute__((visibility("hidden")))
+#else
+#define CPPVUE_HOT_LOCAL
+#endif
+
+namespace cppvue {
+
+class Renderer;
+
+// Remplacement à chaud des fonctions de rendu (build ENABLE_HOT_RELOAD).
+// Le render() généré passe par enter() : il note l'instance et délègue à la
+// dernière version enregistrée par un module rechargé. Les instances gardent
+// leur état réactif (l'objet n'est pas recréé) et seul leur sous-arbre est re-rendu.
+class HotReload {
+public:
+    using RenderFunction = std::function<std::shared_ptr<VNode>(Component&)>;
+
+    static HotReload& instance();
+
+    // Renderer chargé des re-rendus (nul : apply() ne re-rend rien)
+    void attach(Renderer* renderer) { renderer_ = renderer; }
+
+    // Version du script compilée dans le programme principal
+    bool registerLayout(const std::string& component, std::uint64_t scriptHash);
+
+    // Nouveau rendu, depuis l'initialisation statique d'un module chargé après
+    // coup. Refusé (false) si le script diffère : la classe a pu changer de forme
+    bool registerRender(const std::string& component, std::uint64_t scriptHash, RenderFunction render);
+
+    // Appelé en tête du render() généré : rendu rechargé à utiliser, ou nullptr
+    const RenderFunction* enter(const std::string& component, Component& instance);
+
+    // Nombre de rendus acceptés pour component (change à chaque module chargé)
+    std::size_t revision(const std::string& component) const;
+
+    // Re-rend les instances vivantes de component ; renvoie leur nombre
+    std::size_t apply(const std::string& component);
+
+private:
+    HotReload() = default;
+
+    struct Entry {
+        std::uint64_t scriptHash = 0;
+        RenderFunction render;
+        std::size_t revision = 0;
+        std::unordered_map<const Component*, std::weak_ptr<Component>> instances;
+    };
+
+    std::unordered_map<std::string, Entry> entries_;
+    Renderer* renderer_ = nullptr;
+};
+
+} // namespace cppvue
@@ -0,0 +1,71 @@
+#include "component.hpp"
+#include "profiler.hpp"
+
+namespace cppvue {
+
+namespace {
+    // Nom statique du hook pour les spans du profiler
+    [[maybe_unused]] const char* hookName(LifecycleHook hook) {
+        switch (hook) {
+            case LifecycleHook::BEFORE_CREATE: return "hook:beforeCreate";
+            case LifecycleHook::CREATED: return "hook:created";
+            case LifecycleHook::BEFORE_MOUNT: return "hook:beforeMount";
+            case LifecycleHook::MOUNTED: return "hook:mounted";
+            case LifecycleHook::BEFORE_UPDATE: return "hook:beforeUpdate";
+            case LifecycleHook::UPDATED: return "hook:updated";
+            case LifecycleHook::BEFORE_UNMOUNT: return "hook:beforeUnmount";
+            case LifecycleHook::UNMOUNTED: return "hook:unmounted";
+            case LifecycleHook::ERROR_CAPTURED: return "hook:errorCaptured";
+        }
+        return "hook";
+    }
+}
+
+void LifecycleManager::onBeforeCreate(Hook hook) { beforeCreateHooks_.push_back(std::move(hook)); }
+void LifecycleManager::onCreated(Hook hook) { createdHooks_.push_back(std::move(hook)); }
+void LifecycleManager::onBeforeMount(Hook hook) { beforeMountHooks_.push_back(std::move(hook)); }
+void LifecycleManager::onMounted(Hook hook) { mountedHooks_.push_back(std::move(hook)); }
+void LifecycleManager::onBeforeUpdate(Hook hook) { beforeUpdateHooks_.push_back(std::move(hook)); }
+void LifecycleManager::onUpdated(Hook hook) { updatedHooks_.push_back(std::move(hook)); }
+void LifecycleManager::onBeforeUnmount(Hook hook) { beforeUnmountHooks_.push_back(std::move(hook)); }
+void LifecycleManager::onUnmounted(Hook hook) { unmountedHooks_.push_back(std::move(hook)); }
+void LifecycleManager::onErrorCaptured(ErrorHook hook) { errorHooks_.push_back(std::move(hook)); }
+
+void LifecycleManager::callHook(LifecycleHook hook) {
+    CPPVUE_TRACE_SCOPE(hookName(hook));
+
+    const std::vector<Hook>* hooks = nullptr;
+    switch (hook) {
+        case LifecycleHook::BEFORE_CREATE: hooks = &beforeCreateHooks_; break;
+        case LifecycleHook::CREATED: hooks = &createdHooks_; break;
+        case LifecycleHook::BEFORE_MOUNT: hooks = &beforeMountHooks_; break;
+        case LifecycleHook::MOUNTED: hooks = &mountedHooks_; break;
+        case LifecycleHook::BEFORE_UPDATE: hooks = &beforeUpdateHooks_; break;
+        case LifecycleHook::UPDATED: hooks = &updatedHooks_; break;
+        case LifecycleHook::BEFORE_UNMOUNT: hooks = &beforeUnmountHooks_; break;
+        case LifecycleHook::UNMOUNTED: hooks = &unmountedHooks_; break;
+        case LifecycleHook::ERROR_CAPTURED: return;
+    }
+
+    for (const auto& fn : *hooks) {
+        try {
+            fn();
+        } catch (const std::exception& e) {
+            // Sans gestionnaire d'erreur, l'exception remonte à l'appelant
+            if (errorHooks_.empty()) {
+                throw;
+            }
+            callErrorHook(e);
+        }
+    }
+}
+
+void LifecycleManager::callErrorHook(const std::exception& error) {
+    CPPVUE_TRACE_SCOPE("hook:errorCaptured");
+
+    for (const auto& fn : errorHooks_) {
+        fn(error);
+    }
+}
+
+} // namespace cppvue
@@ -0,0 +1,131 @@
+#include "module_loader.hpp"
+#include <dlfcn.h>
+#ifdef __EMSCRIPTEN__
+#include <emscripten.h>
+#endif
+
+namespace cppvue {
+
+// Défini ici et non dans l'en-tête : les modules chargés doivent enregistrer
+// leurs fabriques dans l'instance du programme principal
+ModuleLoader& ModuleLoader::instance() {
+    static ModuleLoader loader;
+    return loader;
+}
+
+void ModuleLoader::addComponent(std::string component, std::string chunk) {
+    componentChunks_[std::move(component)] = std::move(chunk);
+}
+
+const std::string& ModuleLoader::chunkOf(std::string_view component) const {
+    static const std::string none;
+    auto it = componentChunks_.find(std::string(component));
+    return it != componentChunks_.end() ? it->second : none;
+}
+
+bool ModuleLoader::registerFactory(std::string_view component, Factory factory) {
+    factories_[std::string(component)] = factory;
+    return true;
+}
+
+std::shared_ptr<Component> ModuleLoader::create(std::string_view component) const {
+    auto it = factories_.find(std::string(component));
+    return it != factories_.end() ? it->second() : nullptr;
+}
+
+ModuleLoader::State ModuleLoader::state(const std::string& chunk) const {
+    static_cast<void>(**revision_);  // Dépendance du rendu en cours
+    auto it = chunks_.find(chunk);
+    return it != chunks_.end() ? it->second.state : State::NOT_LOADED;
+}
+
+ModuleLoader::State ModuleLoader::componentState(std::string_view component) const {
+    const auto& chunk = chunkOf(component);
+    return chunk.empty() ? State::LOADED : state(chunk);
+}
+
+void ModuleLoader::load(const std::string& chunk, Callback done) {
+    auto& entry = chunks_[chunk];
+    if (entry.state == State::LOADED) {
+        if (done) {
+            done(true);
+        }
+        return;
+    }
+    if (done) {
+        entry.waiting.push_back(std::move(done));
+    }
+    if (entry.state == State::LOADING) {
+        return;
+    }
+    entry.state = State::LOADING;
+
+#ifdef __EMSCRIPTEN__
+    // Asynchrone : la compilation synchrone d'un module wasm est limitée sur
+    // le thread principal du navigateur ; le rendu affiche l'attente
+    std::string path = basePath_ + chunk + ".wasm";
+    emscripten_dlopen(path.c_str(), RTLD_NOW, new std::string(chunk), &ModuleLoader::moduleLoaded,
+                      &ModuleLoader::moduleFailed);
+#else
+    // dlopen exécute l'initialisation statique du module : ses fabriques sont
+    // enregistrées au retour. Le module reste chargé jusqu'à la fin du programme
+    std::string path = basePath_ + chunk + ".so";
+    if (dlopen(path.c_str(), RTLD_NOW | RTLD_GLOBAL) != nullptr) {
+        finish(chunk, true);
+    } else {
+        const char* reason = dlerror();
+        finish(chunk, false, reason != nullptr ? reason : path + ": dlopen failed");
+    }
+#endif
+}
+
+void ModuleLoader::prefetch(const std::string& chunk) {
+    auto it = chunks_.find(chunk);
+    if (it == chunks_.end() || it->second.state != State::FAILED) {
+        load(chunk);
+    }
+}
+
+const std::string& ModuleLoader::error(const std::string& chunk) const {
+    static const std::string none;
+    auto it = chunks_.find(chunk);
+    return it != chunks_.end() ? it->second.error : none;
+}
+
+void ModuleLoader::loadComponent(std::string_view component, Callback done) {
+    const auto& chunk = chunkOf(component);
+    if (chunk.empty()) {
+        if (done) {
+            done(true);
+        }
+        return;
+    }
+    load(chunk, std::move(done));
+}
+
+void ModuleLoader::finish(const std::string& chunk, bool loaded, std::string error) {
+    auto& entry = chunks_[chunk];
+    entry.state = loaded ? State::LOADED : State::FAILED;
+    entry.error = std::move(error);
+
+    // Les callbacks peuvent charger d'autres chunks (préchargement)
+    auto waiting = std::move(entry.waiting);
+    entry.waiting.clear();
+    *revision_ = ++finished_;
+    for (auto& done : waiting) {
+        done(loaded);
+    }
+}
+
+void ModuleLoader::moduleLoaded(void* userData, void* /*handle*/) {
+    std::unique_ptr<std::string> chunk(static_cast<std::string*>(userData));
+    instance().finish(*chunk, true);
+}
+
+void ModuleLoader::moduleFailed(void* userData) {
+    std::unique_ptr<std::string> chunk(static_cast<std::string*>(userData));
+    // emscripten_dlopen ne transmet pas la cause (réseau, instanciation)
+    instance().finish(*chunk, false, instance().basePath_ + *chunk + ".wasm: emscripten_dlopen failed");
+}
+
+} // namespace cppvue
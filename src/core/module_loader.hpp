@@ -0,0 +1,93 @@
+#pragma once
+
+#include "component_table.hpp"
+#include "reactive.hpp"
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace cppvue {
+
+class Component;
+
+// Chargement des chunks de route (cvuec --lazy-chunks) : les composants d'un
+// chunk sont compilés dans un module séparé (module partagé en natif, side
+// module sur wasm) chargé à la première navigation vers une de ses routes.
+// À son initialisation, le module enregistre les fabriques de ses composants.
+class ModuleLoader {
+public:
+    using Factory = ComponentTable::Factory;
+    using Callback = std::function<void(bool loaded)>;
+
+    enum class State {
+        NOT_LOADED,
+        LOADING,
+        LOADED,
+        FAILED
+    };
+
+    static ModuleLoader& instance();
+
+    // Répertoire des modules : <basePath><chunk>.wasm (ou .so en natif)
+    void setBasePath(std::string basePath) { basePath_ = std::move(basePath); }
+
+    // Composant d'un chunk, déclaré par le loadComponents() généré
+    void addComponent(std::string component, std::string chunk);
+
+    // Chunk de component, vide s'il est lié au programme principal
+    const std::string& chunkOf(std::string_view component) const;
+
+    // Depuis l'initialisation statique d'un module chargé
+    bool registerFactory(std::string_view component, Factory factory);
+
+    // Instance de component, nullptr tant que son module n'est pas chargé
+    std::shared_ptr<Component> create(std::string_view component) const;
+
+    // État d'un chunk ; lu depuis un rendu, il en devient une dépendance
+    // réactive : le rendu est rejoué à la fin du chargement
+    State state(const std::string& chunk) const;
+    State componentState(std::string_view component) const;
+
+    // Charge le chunk (une seule fois) ; done est appelé à la fin du chargement,
+    // tout de suite si le chunk est déjà chargé. Un chunk en échec est rechargé :
+    // une navigation vers sa route retente après une erreur réseau passagère
+    void load(const std::string& chunk, Callback done = {});
+    void loadComponent(std::string_view component, Callback done = {});
+
+    // Indice de navigation probable : chargement en arrière-plan, sans attente.
+    // Un chunk en échec n'est pas retenté (seule une navigation le fait)
+    void prefetch(const std::string& chunk);
+
+    // Cause du dernier échec de chargement du chunk (dlerror en natif), vide sinon
+    const std::string& error(const std::string& chunk) const;
+
+private:
+    ModuleLoader() = default;
+
+    struct Chunk {
+        State state = State::NOT_LOADED;
+        std::vector<Callback> waiting;
+        std::string error;
+    };
+
+    // Fin du chargement (natif : dans load ; wasm : callbacks d'emscripten_dlopen,
+    // userData est le nom du chunk alloué par load)
+    void finish(const std::string& chunk, bool loaded, std::string error = {});
+    static void moduleLoaded(void* userData, void* handle);
+    static void moduleFailed(void* userData);
+
+    std::string basePath_ = "chunks/";
+    std::unordered_map<std::string, Chunk> chunks_;
+    std::unordered_map<std::string, std::string> componentChunks_;
+    std::unordered_map<std::string, Factory> factories_;
+
+    // Nombre de chargements terminés, publié dans revision_ (dépendance des rendus)
+    std::size_t finished_ = 0;
+    std::shared_ptr<Reactive<std::size_t>> revision_ = std::make_shared<Reactive<std::size_t>>(0);
+};
+
+} // namespace cppvue
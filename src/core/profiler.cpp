@@ -0,0 +1,128 @@
+#include "profiler.hpp"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+namespace cppvue {
+
+namespace {
+    // Échappe une chaîne pour l'export JSON
+    void writeJsonString(std::ostream& out, const char* str) {
+        out << '"';
+        for (const char* c = str; *c; ++c) {
+            switch (*c) {
+                case '"': out << "\\\""; break;
+                case '\\': out << "\\\\"; break;
+                case '\n': out << "\\n"; break;
+                case '\t': out << "\\t"; break;
+                default:
+                    if (static_cast<unsigned char>(*c) < 0x20) {
+                        out << ' ';
+                    } else {
+                        out << *c;
+                    }
+            }
+        }
+        out << '"';
+    }
+}
+
+void Profiler::start() {
+    enabled_.store(true, std::memory_order_relaxed);
+}
+
+void Profiler::stop() {
+    enabled_.store(false, std::memory_order_relaxed);
+}
+
+void Profiler::clear() {
+    std::lock_guard<std::mutex> lock(buffersMutex_);
+    for (const auto& buffer : buffers_) {
+        buffer->clear();
+    }
+}
+
+std::uint64_t Profiler::now() const {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - origin_).count();
+}
+
+ThreadTraceBuffer& Profiler::localBuffer() {
+    // Chaque thread obtient son buffer à la première utilisation
+    thread_local std::shared_ptr<ThreadTraceBuffer> buffer = [] {
+        auto& profiler = instance();
+        std::lock_guard<std::mutex> lock(profiler.buffersMutex_);
+        auto created = std::make_shared<ThreadTraceBuffer>(profiler.nextThreadId_++);
+        profiler.buffers_.push_back(created);
+        return created;
+    }();
+    return *buffer;
+}
+
+void Profiler::begin(const char* name, const char* component) {
+    localBuffer().push({name, component, now(), 0, 0, TraceEvent::Phase::BEGIN});
+}
+
+void Profiler::end(const char* name, const char* component,
+                   std::uint32_t vnodeCount, std::uint32_t domOpCount) {
+    localBuffer().push({name, component, now(), vnodeCount, domOpCount, TraceEvent::Phase::END});
+}
+
+std::string Profiler::exportChromeTrace() const {
+    std::ostringstream out;
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+    std::lock_guard<std::mutex> lock(buffersMutex_);
+    bool first = true;
+    for (const auto& buffer : buffers_) {
+        // Seuls les événements publiés (release) avant cette lecture sont exportés
+        auto count = buffer->size();
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto& event = (*buffer)[i];
+            if (!first) out << ",";
+            first = false;
+
+            out << "{\"name\":";
+            writeJsonString(out, event.name);
+            out << ",\"cat\":\"cppvue\",\"ph\":\"" << static_cast<char>(event.phase) << "\"";
+            out << ",\"ts\":" << event.timestamp / 1000 << "." << event.timestamp % 1000 / 100;
+            out << ",\"pid\":1,\"tid\":" << buffer->threadId();
+
+            out << ",\"args\":{";
+            bool firstArg = true;
+            if (event.component) {
+                out << "\"component\":";
+                writeJsonString(out, event.component);
+                firstArg = false;
+            }
+            if (event.phase == TraceEvent::Phase::END) {
+                if (!firstArg) out << ",";
+                out << "\"vnodes\":" << event.vnodeCount;
+                out << ",\"domOps\":" << event.domOpCount;
+            }
+            out << "}}";
+        }
+
+        if (buffer->dropped() > 0) {
+            if (!first) out << ",";
+            first = false;
+            out << "{\"name\":\"dropped events\",\"ph\":\"i\",\"s\":\"t\",\"ts\":0,\"pid\":1"
+                << ",\"tid\":" << buffer->threadId()
+                << ",\"args\":{\"count\":" << buffer->dropped() << "}}";
+        }
+    }
+
+    out << "]}";
+    return out.str();
+}
+
+bool Profiler::writeChromeTrace(const std::filesystem::path& path) const {
+    std::ofstream file(path);
+    if (!file) {
+        return false;
+    }
+    file << exportChromeTrace();
+    return static_cast<bool>(file);
+}
+
+} // namespace cppvue
@@ -0,0 +1,190 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+namespace cppvue {
+
+// Événement de trace au format Chrome Trace Event (B/E)
+struct TraceEvent {
+    enum class Phase : char {
+        BEGIN = 'B',
+        END = 'E'
+    };
+
+    const char* name;          // Littéral statique, jamais copié
+    const char* component;     // Nom du composant (typeid), peut être nul
+    std::uint64_t timestamp;   // Nanosecondes depuis le démarrage du profiler
+    std::uint32_t vnodeCount;  // VNodes traités pendant le span (END uniquement)
+    std::uint32_t domOpCount;  // Opérations DOM émises pendant le span (END uniquement)
+    Phase phase;
+};
+
+// Buffer d'événements propre à un thread.
+// Un seul écrivain (le thread propriétaire), lecture sans verrou par l'export.
+// Le vidage est une demande (génération) appliquée par le propriétaire à son
+// prochain push : seul ce thread écrit size_ et les événements.
+class ThreadTraceBuffer {
+public:
+    static constexpr std::size_t CAPACITY = 1 << 16;
+
+    explicit ThreadTraceBuffer(std::uint32_t threadId)
+        : threadId_(threadId), events_(CAPACITY) {}
+
+    void push(const TraceEvent& event) {
+        auto requested = clearRequested_.load(std::memory_order_acquire);
+        bool clearing = requested != clearApplied_.load(std::memory_order_relaxed);
+        auto index = clearing ? 0 : size_.load(std::memory_order_relaxed);
+        if (clearing) {
+            dropped_.store(0, std::memory_order_relaxed);
+        }
+        if (index >= CAPACITY) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        events_[index] = event;
+        size_.store(index + 1, std::memory_order_release);
+        if (clearing) {
+            clearApplied_.store(requested, std::memory_order_release);
+        }
+    }
+
+    std::uint32_t threadId() const { return threadId_; }
+
+    // Un vidage en attente masque les anciens événements
+    std::size_t size() const { return clearPending() ? 0 : size_.load(std::memory_order_acquire); }
+    std::size_t dropped() const { return clearPending() ? 0 : dropped_.load(std::memory_order_relaxed); }
+    const TraceEvent& operator[](std::size_t index) const { return events_[index]; }
+
+    // Depuis n'importe quel thread, sous le verrou du Profiler (exclusif avec l'export)
+    void clear() {
+        clearRequested_.fetch_add(1, std::memory_order_release);
+    }
+
+    // Compteurs cumulés du thread, utilisés pour calculer les deltas des spans
+    std::uint32_t vnodeCounter = 0;
+    std::uint32_t domOpCounter = 0;
+
+private:
+    std::uint32_t threadId_;
+    std::vector<TraceEvent> events_;
+    std::atomic<std::size_t> size_{0};
+    std::atomic<std::size_t> dropped_{0};
+    std::atomic<std::uint64_t> clearRequested_{0};
+    std::atomic<std::uint64_t> clearApplied_{0};
+
+    bool clearPending() const {
+        return clearApplied_.load(std::memory_order_acquire) !=
+               clearRequested_.load(std::memory_order_acquire);
+    }
+};
+
+// Profiler de rendu, patch et exécution des effets
+class Profiler {
+public:
+    static Profiler& instance() {
+        static Profiler profiler;
+        return profiler;
+    }
+
+    // Activation à l'exécution (le code n'existe que si CPPVUE_ENABLE_PROFILER est défini)
+    void start();
+    void stop();
+    bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    // Vide tous les buffers (appliqué par chaque thread à son prochain événement)
+    void clear();
+
+    // Enregistrement des spans
+    void begin(const char* name, const char* component);
+    void end(const char* name, const char* component,
+             std::uint32_t vnodeCount, std::uint32_t domOpCount);
+
+    // Compteurs
+    static void countVNodes(std::uint32_t count) { localBuffer().vnodeCounter += count; }
+    static void countDomOp() { ++localBuffer().domOpCounter; }
+
+    // Export au format Chrome Trace Event (lisible dans Perfetto / chrome://tracing)
+    std::string exportChromeTrace() const;
+    bool writeChromeTrace(const std::filesystem::path& path) const;
+
+    std::uint64_t now() const;
+    static ThreadTraceBuffer& localBuffer();
+
+private:
+    Profiler() : origin_(std::chrono::steady_clock::now()) {}
+
+    std::atomic<bool> enabled_{false};
+    std::chrono::steady_clock::time_point origin_;
+
+    // Le verrou ne protège que l'enregistrement des threads et l'export
+    mutable std::mutex buffersMutex_;
+    std::vector<std::shared_ptr<ThreadTraceBuffer>> buffers_;
+    std::uint32_t nextThreadId_ = 1;
+};
+
+// Span RAII : enregistre le début à la construction et la fin à la destruction
+class TraceScope {
+public:
+    explicit TraceScope(const char* name, const char* component = nullptr)
+        : name_(name), component_(component) {
+        auto& profiler = Profiler::instance();
+        active_ = profiler.enabled();
+        if (active_) {
+            auto& buffer = Profiler::localBuffer();
+            vnodeStart_ = buffer.vnodeCounter;
+            domOpStart_ = buffer.domOpCounter;
+            profiler.begin(name_, component_);
+        }
+    }
+
+    template<typename C>
+    TraceScope(const char* name, const C& component)
+        : TraceScope(name, typeid(component).name()) {}
+
+    ~TraceScope() {
+        if (active_) {
+            auto& buffer = Profiler::localBuffer();
+            Profiler::instance().end(name_, component_,
+                                     buffer.vnodeCounter - vnodeStart_,
+                                     buffer.domOpCounter - domOpStart_);
+        }
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    const char* name_;
+    const char* component_;
+    std::uint32_t vnodeStart_ = 0;
+    std::uint32_t domOpStart_ = 0;
+    bool active_ = false;
+};
+
+} // namespace cppvue
+
+// Macros d'instrumentation : ne génèrent aucun code sans CPPVUE_ENABLE_PROFILER
+#define CPPVUE_TRACE_CONCAT_IMPL(a, b) a##b
+#define CPPVUE_TRACE_CONCAT(a, b) CPPVUE_TRACE_CONCAT_IMPL(a, b)
+
+#ifdef CPPVUE_ENABLE_PROFILER
+#define CPPVUE_TRACE_SCOPE(name) \
+    ::cppvue::TraceScope CPPVUE_TRACE_CONCAT(cppvueTraceScope_, __LINE__)(name)
+#define CPPVUE_TRACE_COMPONENT_SCOPE(name, component) \
+    ::cppvue::TraceScope CPPVUE_TRACE_CONCAT(cppvueTraceScope_, __LINE__)(name, component)
+#define CPPVUE_TRACE_VNODES(count) ::cppvue::Profiler::countVNodes(count)
+#define CPPVUE_TRACE_DOM_OP() ::cppvue::Profiler::countDomOp()
+#else
+#define CPPVUE_TRACE_SCOPE(name) ((void)0)
+#define CPPVUE_TRACE_COMPONENT_SCOPE(name, component) ((void)0)
+#define CPPVUE_TRACE_VNODES(count) ((void)0)
+#define CPPVUE_TRACE_DOM_OP() ((void)0)
+#endif
@@ -1,4 +1,5 @@
 #include "reactive.hpp"
+#include "profiler.hpp"
 
 namespace cppvue {
 
@@ -30,6 +31,8 @@ void Dependency::notify() {
 }
 
 void Effect::run() {
+    CPPVUE_TRACE_SCOPE("Effect::run");
+
     // Nettoyage des anciennes dépendances
     cleanup();
 
@@ -0,0 +1,301 @@
+#pragma once
+
+#include "component.hpp"
+#include <any>
+#include <concepts>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Helpers utilisés par les fonctions render() générées par cvuec.
+// Toute la structure du template est résolue à la compilation ; il ne reste ici
+// que des conversions de valeurs et la construction des VNodes.
+namespace cppvue::render {
+
+using Children = std::vector<std::shared_ptr<VNode>>;
+using Props = std::unordered_map<std::string, std::string>;
+using DomHandler = std::function<void(void*)>;
+using ComponentHandler = std::function<void(std::any)>;
+
+template<typename T>
+concept ReactiveValue = std::derived_from<std::remove_cvref_t<T>, Dependency>;
+
+template<typename T>
+struct IsSharedPtr : std::false_type {};
+
+template<typename T>
+struct IsSharedPtr<std::shared_ptr<T>> : std::true_type {};
+
+// Lecture d'une valeur de binding : Ref/Computed (suivie par l'effet courant),
+// pointeur partagé vers une valeur réactive, ou valeur brute
+template<typename T>
+const T& unref(const Reactive<T>& value) {
+    return *value;
+}
+
+template<typename T>
+decltype(auto) unref(const std::shared_ptr<T>& value);
+
+template<typename T>
+    requires (!ReactiveValue<T> && !IsSharedPtr<std::remove_cvref_t<T>>::value)
+const T& unref(const T& value) {
+    return value;
+}
+
+template<typename T>
+decltype(auto) unref(const std::shared_ptr<T>& value) {
+    if constexpr (ReactiveValue<T>) {
+        return unref(*value);
+    } else {
+        return *value;
+    }
+}
+
+// Conversion d'une valeur en texte affiché ({{ }} et attributs liés)
+template<typename T>
+std::string toDisplayString(const T& value) {
+    using V = std::remove_cvref_t<T>;
+    if constexpr (std::is_same_v<V, std::string>) {
+        return value;
+    } else if constexpr (std::is_convertible_v<const V&, const char*>) {
+        const char* str = value;
+        return str ? str : "";
+    } else if constexpr (std::is_same_v<V, bool>) {
+        return value ? "true" : "false";
+    } else if constexpr (std::is_arithmetic_v<V>) {
+        std::ostringstream out;
+        out << value;
+        return out.str();
+    } else if constexpr (std::is_same_v<V, std::nullptr_t>) {
+        return "";
+    } else {
+        std::ostringstream out;
+        out << value;
+        return out.str();
+    }
+}
+
+// Vérité à la JavaScript pour c-if, c-show et les classes conditionnelles
+template<typename T>
+bool truthy(const T& value) {
+    using V = std::remove_cvref_t<T>;
+    if constexpr (std::is_same_v<V, bool>) {
+        return value;
+    } else if constexpr (std::is_arithmetic_v<V> || std::is_pointer_v<V>) {
+        return value != V{};
+    } else if constexpr (requires { value.empty(); }) {
+        return !value.empty();
+    } else {
+        return static_cast<bool>(value);
+    }
+}
+
+// :class="{ name: condition }"
+inline std::string classList(std::initializer_list<std::pair<const char*, bool>> classes) {
+    std::string result;
+    for (const auto& [name, enabled] : classes) {
+        if (enabled) {
+            if (!result.empty()) result += ' ';
+            result += name;
+        }
+    }
+    return result;
+}
+
+// Fusion de l'attribut class statique et du binding :class
+inline std::string joinClass(const std::string& staticClass, const std::string& dynamicClass) {
+    if (staticClass.empty()) return dynamicClass;
+    if (dynamicClass.empty()) return staticClass;
+    return staticClass + ' ' + dynamicClass;
+}
+
+// Attribut lié : un booléen faux retire l'attribut, vrai le pose vide
+template<typename T>
+void bindProp(Props& props, const std::string& name, const T& value) {
+    if constexpr (std::is_same_v<std::remove_cvref_t<T>, bool>) {
+        if (value) {
+            props[name] = "";
+        } else {
+            props.erase(name);
+        }
+    } else {
+        props[name] = toDisplayString(value);
+    }
+}
+
+// c-show : masque l'élément sans le retirer du DOM
+template<typename T>
+void showIf(Props& props, const T& condition) {
+    if (!truthy(condition)) {
+        props["style"] += "display: none;";
+    }
+}
+
+inline std::shared_ptr<VNode> element(std::string tag, Props props, Children children) {
+    auto node = std::make_shared<VNode>();
+    node->tag = std::move(tag);
+    node->props = std::move(props);
+    node->children = std::move(children);
+    return node;
+}
+
+inline std::shared_ptr<VNode> textNode(std::string text) {
+    auto node = std::make_shared<VNode>();
+    node->textContent = std::move(text);
+    return node;
+}
+
+// Préallocation des enfants produits par un c-for
+template<typename Range>
+void reserveMore(Children& children, const Range& range) {
+    if constexpr (requires { std::size(range); }) {
+        children.reserve(children.size() + std::size(range));
+    }
+}
+
+// Racine du template : un seul nœud, sinon un conteneur div
+inline std::shared_ptr<VNode> fragment(Children nodes) {
+    if (nodes.size() == 1) {
+        return std::move(nodes.front());
+    }
+    return element("div", {}, std::move(nodes));
+}
+
+// :key
+template<typename T>
+std::shared_ptr<VNode> keyed(std::shared_ptr<VNode> node, const T& key) {
+    node->key = toDisplayString(key);
+    return node;
+}
+
+// Affectation depuis un handler (x = valeur, c-model)
+template<typename Target, typename Value>
+void assign(Target& target, Value&& value) {
+    if constexpr (IsSharedPtr<std::remove_cvref_t<Target>>::value) {
+        *target = std::forward<Value>(value);
+    } else {
+        target = std::forward<Value>(value);
+    }
+}
+
+// Événement DOM reçu par un DomHandler : le PlatformRenderer passe un DomEvent*
+// (ou nullptr), puis applique au retour preventDefault/stopPropagation demandés
+struct DomEvent {
+    std::string value;   // value de l'input
+    std::string key;     // KeyboardEvent.key
+    void* target = nullptr;
+    void* currentTarget = nullptr;
+    bool ctrlKey = false;
+    bool altKey = false;
+    bool shiftKey = false;
+    bool metaKey = false;
+    bool defaultPrevented = false;
+    bool propagationStopped = false;
+};
+
+inline std::string eventValue(void* event) {
+    return event ? static_cast<const DomEvent*>(event)->value : std::string();
+}
+
+// Modificateurs d'événement appliqués par les handlers générés (@keyup.enter, @submit.prevent...)
+inline void preventDefault(void* event) {
+    if (event) static_cast<DomEvent*>(event)->defaultPrevented = true;
+}
+
+inline void stopPropagation(void* event) {
+    if (event) static_cast<DomEvent*>(event)->propagationStopped = true;
+}
+
+// .self : l'événement vient de l'élément lui-même, pas d'un descendant
+inline bool eventIsSelf(void* event) {
+    return event && static_cast<const DomEvent*>(event)->target ==
+                    static_cast<const DomEvent*>(event)->currentTarget;
+}
+
+// .ctrl, .alt, .shift, .meta
+inline bool eventSystemKey(void* event, std::string_view modifier) {
+    if (!event) return false;
+    const auto& dom = *static_cast<const DomEvent*>(event);
+    return modifier == "ctrl" ? dom.ctrlKey : modifier == "alt" ? dom.altKey :
+           modifier == "shift" ? dom.shiftKey : dom.metaKey;
+}
+
+// Filtre de touche : alias de Vue (enter, esc, space...) ou KeyboardEvent.key
+// en kebab-case (page-down pour PageDown)
+inline bool eventKeyIs(void* event, std::string_view modifier) {
+    if (!event) return false;
+    const std::string& key = static_cast<const DomEvent*>(event)->key;
+    if (modifier == "enter") return key == "Enter";
+    if (modifier == "tab") return key == "Tab";
+    if (modifier == "delete") return key == "Delete" || key == "Backspace";
+    if (modifier == "esc") return key == "Escape" || key == "Esc";
+    if (modifier == "space") return key == " " || key == "Spacebar";
+    if (modifier == "up") return key == "ArrowUp";
+    if (modifier == "down") return key == "ArrowDown";
+    if (modifier == "left") return key == "ArrowLeft";
+    if (modifier == "right") return key == "ArrowRight";
+    std::string kebab;
+    for (std::size_t i = 0; i < key.size(); ++i) {
+        char c = key[i];
+        if (c >= 'A' && c <= 'Z') {
+            if (i > 0) kebab += '-';
+            c = static_cast<char>(c - 'A' + 'a');
+        }
+        kebab += c;
+    }
+    return kebab == modifier;
+}
+
+// État d'un handler .once, reporté par le Renderer sur les VNodes suivants du même élément
+inline std::shared_ptr<bool> onceFlag(VNode& node, const std::string& handler) {
+    return node.onceFired[handler] = std::make_shared<bool>(false);
+}
+
+// Argument d'un événement de composant (emit), converti vers le type attendu
+struct EventArg {
+    std::any value;
+
+    template<typename T>
+    operator T() const {
+        return std::any_cast<T>(value);
+    }
+};
+
+// Composant enfant : instance conservée d'un rendu à l'autre sous sa clé
+template<typename T>
+std::shared_ptr<VNode> component(Component* parent,
+                                 const std::string& key,
+                                 std::unordered_map<std::string, std::any> props,
+                                 std::unordered_map<std::string, ComponentHandler> handlers) {
+    static_assert(std::is_base_of_v<Component, T>, "T must inherit from Component");
+
+    auto child = std::dynamic_pointer_cast<T>(parent->findChild(key));
+    if (!child) {
+        child = std::make_shared<T>();
+        child->lifecycle().callHook(LifecycleHook::CREATED);
+        parent->adoptChild(key, child);
+    }
+
+    for (auto& [name, value] : props) {
+        child->setProp(name, std::move(value));
+    }
+    for (auto& [name, handler] : handlers) {
+        child->setEventHandler(name, std::move(handler));
+    }
+
+    auto vnode = child->render();
+    vnode->component = child;
+    if (vnode->key.empty()) {
+        vnode->key = key;
+    }
+    return vnode;
+}
+
+} // namespace cppvue::render
@@ -1,74 +1,145 @@
 #include "renderer.hpp"
+#include "profiler.hpp"
 #include <algorithm>
+#include <cctype>
+#include <unordered_set>
 #include <queue>
 
 namespace cppvue {
 
 Renderer::Renderer(std::unique_ptr<PlatformRenderer> platformRenderer)
-    : platformRenderer_(std::move(platformRenderer)) {}
+    : platformRenderer_(std::move(platformRenderer)) {
+#ifdef CPPVUE_ENABLE_PROFILER
+    // Compte chaque opération DOM pour les spans du profiler
+    platformRenderer_ = std::make_unique<TracingPlatformRenderer>(std::move(platformRenderer_));
+#endif
+}
 
 void Renderer::mount(std::shared_ptr<Component> component, void* container) {
+    CPPVUE_TRACE_COMPONENT_SCOPE("Renderer::mount", *component);
+
     // Appelle le hook beforeMount
     component->lifecycle().callHook(LifecycleHook::BEFORE_MOUNT);
     
     // Rend le composant
-    auto vnode = component->render();
-    
-    // Crée l'élément DOM
-    void* element = createDOMElement(vnode);
+    std::shared_ptr<VNode> vnode;
+    {
+        CPPVUE_TRACE_COMPONENT_SCOPE("Component::render", *component);
+        vnode = component->render();
+    }
     
-    // Ajoute l'élément au container
-    platformRenderer_->appendChild(container, element);
+    // Crée l'élément DOM et l'ajoute au container
+    void* element = nullptr;
+    if (htmlMount_ && canMaterialize(*vnode)) {
+        element = materializeHTML(vnode, container);
+    }
+    if (!element) {
+        element = createDOMElement(vnode);
+        platformRenderer_->appendChild(container, element);
+    }
     
     // Met à jour les caches
+    vnode->component = component;
     nodeToElement_[vnode] = element;
     elementToNode_[element] = vnode;
+    rememberComponentRoot(vnode);
     
     // Appelle le hook mounted
     component->lifecycle().callHook(LifecycleHook::MOUNTED);
 }
 
 void Renderer::update(std::shared_ptr<Component> component) {
+    CPPVUE_TRACE_COMPONENT_SCOPE("Renderer::update", *component);
+
+    // Composant jamais monté, ou retiré du DOM depuis
+    auto root = componentRoots_.find(component.get());
+    if (root == componentRoots_.end()) {
+        return;
+    }
+    auto current = root->second;
+    auto mapped = nodeToElement_.find(current);
+    if (mapped == nodeToElement_.end()) {
+        componentRoots_.erase(root);
+        return;
+    }
+    
     // Appelle le hook beforeUpdate
     component->lifecycle().callHook(LifecycleHook::BEFORE_UPDATE);
     
-    // Obtient l'ancien et le nouveau VNode
-    auto oldVNode = elementToNode_[nodeToElement_[component->render()]];
-    auto newVNode = component->render();
+    std::shared_ptr<VNode> newVNode;
+    {
+        CPPVUE_TRACE_COMPONENT_SCOPE("Component::render", *component);
+        newVNode = component->render();
+    }
+    newVNode->component = component;
+    if (newVNode->key.empty()) {
+        newVNode->key = current->key;
+    }
+    
+    // L'ancien arbre passe dans un VNode temporaire pour le diff ; l'objet
+    // racine, référencé par l'arbre du parent, reçoit ensuite le nouveau contenu
+    auto previous = std::make_shared<VNode>(*current);
+    void* oldElement = mapped->second;
+    nodeToElement_.erase(mapped);
+    nodeToElement_[previous] = oldElement;
+    elementToNode_[oldElement] = previous;
+    
+    // Applique les différences, limitées au sous-arbre du composant
+    patch(previous, newVNode, platformRenderer_->parentNode(oldElement));
     
-    // Applique les différences
-    patch(oldVNode, newVNode, nullptr);
+    void* newElement = nodeToElement_[newVNode];
+    nodeToElement_.erase(previous);
+    nodeToElement_.erase(newVNode);
+    *current = std::move(*newVNode);
+    nodeToElement_[current] = newElement;
+    elementToNode_[newElement] = current;
+    componentRoots_[component.get()] = current;
     
     // Appelle le hook updated
     component->lifecycle().callHook(LifecycleHook::UPDATED);
 }
 
 void Renderer::unmount(std::shared_ptr<Component> component) {
+    CPPVUE_TRACE_COMPONENT_SCOPE("Renderer::unmount", *component);
+
+    auto root = componentRoots_.find(component.get());
+    if (root == componentRoots_.end()) {
+        return;
+    }
+    auto vnode = root->second;
+    
     // Appelle le hook beforeUnmount
     component->lifecycle().callHook(LifecycleHook::BEFORE_UNMOUNT);
     
-    // Trouve l'élément DOM
-    auto vnode = component->render();
-    auto element = nodeToElement_[vnode];
-    
     // Supprime l'élément du DOM
-    auto parent = platformRenderer_->getParentNode(element);
-    platformRenderer_->removeChild(parent, element);
+    auto element = nodeToElement_[vnode];
+    if (auto parent = platformRenderer_->parentNode(element)) {
+        platformRenderer_->removeChild(parent, element);
+    }
     
     // Nettoie les caches
-    nodeToElement_.erase(vnode);
-    elementToNode_.erase(element);
+    forgetSubtree(vnode);
     
     // Appelle le hook unmounted
     component->lifecycle().callHook(LifecycleHook::UNMOUNTED);
 }
 
 void* Renderer::createDOMElement(std::shared_ptr<VNode> vnode) {
+    // Instance d'un squelette statique : un seul clone au lieu d'une construction nœud par nœud
+    if (vnode->templateId >= 0) {
+        if (void* cloned = instantiateTemplate(vnode)) {
+            return cloned;
+        }
+    }
+    
+    CPPVUE_TRACE_VNODES(1);
     void* element;
     
     if (vnode->tag.empty()) {
         // Nœud texte
         element = platformRenderer_->createTextNode(vnode->textContent);
+    } else if ((element = acquireFromPool(vnode))) {
+        // Élément recyclé, props, listeners et enfants déjà mis à jour par acquireFromPool
     } else {
         // Élément normal
         element = platformRenderer_->createElement(vnode->tag);
@@ -78,20 +149,425 @@ void* Renderer::createDOMElement(std::shared_ptr<VNode> vnode) {
             platformRenderer_->setAttribute(element, name, value);
         }
         
+        // Contenu c-html ou texte seul : une seule écriture au lieu de nœuds enfants
+        if (vnode->innerHTML) {
+            platformRenderer_->setElementHTML(element, *vnode->innerHTML);
+        } else if (vnode->children.empty() && !vnode->textContent.empty()) {
+            platformRenderer_->setElementText(element, vnode->textContent);
+        }
+        
         // Crée les enfants
         for (const auto& child : vnode->children) {
             void* childElement = createDOMElement(child);
             platformRenderer_->appendChild(element, childElement);
         }
+        
+        bindEvents(element, *vnode);
     }
     
+    // Met à jour les caches
+    nodeToElement_[vnode] = element;
+    elementToNode_[element] = vnode;
+    rememberComponentRoot(vnode);
+    
     return element;
 }
 
+void Renderer::bindEvents(void* element, const VNode& vnode) {
+    if (vnode.events.empty()) {
+        return;
+    }
+    auto& listeners = listeners_[element];
+    for (const auto& [name, handler] : vnode.events) {
+        auto* callback = std::any_cast<std::function<void(void*)>>(&handler);
+        if (!callback) {
+            continue;
+        }
+        auto& listener = listeners[name];
+        if (listener.handler) {
+            *listener.handler = *callback;
+            continue;
+        }
+        listener.handler = std::make_shared<std::function<void(void*)>>(*callback);
+        listener.dispatcher = [current = listener.handler](void* event) {
+            if (*current) {
+                (*current)(event);
+            }
+        };
+        platformRenderer_->addEventListener(element, name, listener.dispatcher);
+    }
+}
+
+void Renderer::patchEvents(void* element, const VNode& newNode) {
+    auto it = listeners_.find(element);
+    if (it == listeners_.end()) {
+        bindEvents(element, newNode);
+        return;
+    }
+    // Événements disparus : le dispatcher est vidé avant d'être retiré, il reste
+    // inerte même si la plateforme ne retrouve pas l'instance enregistrée
+    auto& listeners = it->second;
+    for (auto listener = listeners.begin(); listener != listeners.end();) {
+        if (newNode.events.count(listener->first) == 0) {
+            *listener->second.handler = nullptr;
+            platformRenderer_->removeEventListener(element, listener->first, listener->second.dispatcher);
+            listener = listeners.erase(listener);
+        } else {
+            ++listener;
+        }
+    }
+    bindEvents(element, newNode);
+    if (listeners.empty()) {
+        listeners_.erase(element);
+    }
+}
+
+// Matérialisation HTML du montage initial
+
+namespace {
+    // Éléments sans balise fermante
+    bool isVoidElement(const std::string& tag) {
+        static const std::unordered_set<std::string> voidElements = {
+            "area", "base", "br", "col", "embed", "hr", "img",
+            "input", "link", "meta", "source", "track", "wbr"
+        };
+        return voidElements.count(tag) > 0;
+    }
+    
+    // Éléments que le parser HTML restructure ou interprète (contenu brut, tables...)
+    bool isParserSensitive(const std::string& tag) {
+        static const std::unordered_set<std::string> sensitive = {
+            "table", "thead", "tbody", "tfoot", "tr", "td", "th", "caption",
+            "colgroup", "select", "option", "optgroup", "p", "template",
+            "script", "style", "textarea", "title", "svg", "math",
+            "iframe", "noscript", "noembed", "noframes", "xmp", "plaintext"
+        };
+        return sensitive.count(tag) > 0;
+    }
+    
+    // Balises que le parser ferme à l'ouverture d'une balise du même groupe :
+    // imbriquées, elles deviennent sœurs avec le même nombre de nœuds
+    unsigned nestingGroup(const std::string& tag) {
+        static const std::unordered_map<std::string, unsigned> groups = {
+            {"a", 1u << 0}, {"li", 1u << 1}, {"button", 1u << 2}, {"form", 1u << 3},
+            {"dd", 1u << 4}, {"dt", 1u << 4},
+            {"h1", 1u << 5}, {"h2", 1u << 5}, {"h3", 1u << 5},
+            {"h4", 1u << 5}, {"h5", 1u << 5}, {"h6", 1u << 5}
+        };
+        auto it = groups.find(tag);
+        return it != groups.end() ? it->second : 0;
+    }
+    
+    bool isTableContent(const std::string& tag) {
+        static const std::unordered_set<std::string> tableContent = {
+            "table", "thead", "tbody", "tfoot", "tr", "td", "th", "caption", "colgroup"
+        };
+        return tableContent.count(tag) > 0;
+    }
+    
+    bool isValidName(const std::string& name) {
+        if (name.empty() || !std::isalpha(static_cast<unsigned char>(name[0]))) {
+            return false;
+        }
+        return std::all_of(name.begin(), name.end(), [](char c) {
+            return std::isalnum(static_cast<unsigned char>(c)) || c == '-' || c == '_';
+        });
+    }
+    
+    void appendEscaped(std::string& out, const std::string& text, bool attribute) {
+        for (char c : text) {
+            switch (c) {
+                case '&': out += "&amp;"; break;
+                case '<': out += "&lt;"; break;
+                case '>': out += "&gt;"; break;
+                case '"':
+                    if (attribute) { out += "&quot;"; break; }
+                    [[fallthrough]];
+                default: out += c;
+            }
+        }
+    }
+}
+
+bool Renderer::canMaterialize(const VNode& vnode, bool inTemplate, unsigned nesting) const {
+    if (vnode.tag.empty()) {
+        // Un nœud texte vide n'existerait pas après parsing
+        return !vnode.textContent.empty();
+    }
+    
+    if (!isValidName(vnode.tag)) {
+        return false;
+    }
+    // Le contenu d'un <template> accepte les lignes et cellules de table hors contexte
+    if (isParserSensitive(vnode.tag) && !(inTemplate && isTableContent(vnode.tag))) {
+        return false;
+    }
+    if (isVoidElement(vnode.tag) && (!vnode.children.empty() || !vnode.textContent.empty())) {
+        return false;
+    }
+    unsigned group = nestingGroup(vnode.tag);
+    if (nesting & group) {
+        return false;
+    }
+    nesting |= group;
+    // Les nœuds créés par le HTML de c-html ne correspondent à aucun VNode
+    if (vnode.innerHTML) {
+        return false;
+    }
+    for (const auto& [name, value] : vnode.props) {
+        if (!isValidName(name)) {
+            return false;
+        }
+    }
+    
+    // Deux nœuds texte adjacents seraient fusionnés par le parser
+    bool previousIsText = false;
+    for (const auto& child : vnode.children) {
+        bool isText = child->tag.empty();
+        if ((isText && previousIsText) || !canMaterialize(*child, inTemplate, nesting)) {
+            return false;
+        }
+        previousIsText = isText;
+    }
+    return true;
+}
+
+void Renderer::serializeHTML(const VNode& vnode, std::string& out) const {
+    if (vnode.tag.empty()) {
+        appendEscaped(out, vnode.textContent, false);
+        return;
+    }
+    
+    out += '<';
+    out += vnode.tag;
+    for (const auto& [name, value] : vnode.props) {
+        out += ' ';
+        out += name;
+        out += "=\"";
+        appendEscaped(out, value, true);
+        out += '"';
+    }
+    out += '>';
+    
+    if (isVoidElement(vnode.tag)) {
+        return;
+    }
+    
+    if (vnode.innerHTML) {
+        out += *vnode.innerHTML;
+    } else if (vnode.children.empty()) {
+        appendEscaped(out, vnode.textContent, false);
+    }
+    for (const auto& child : vnode.children) {
+        serializeHTML(*child, out);
+    }
+    
+    out += "</";
+    out += vnode.tag;
+    out += '>';
+}
+
+std::size_t Renderer::countMaterializedNodes(const VNode& vnode) const {
+    std::size_t count = 1;
+    if (!vnode.tag.empty() && vnode.children.empty() && !vnode.textContent.empty()) {
+        count++; // Nœud texte implicite du contenu texte seul
+    }
+    for (const auto& child : vnode.children) {
+        count += countMaterializedNodes(*child);
+    }
+    return count;
+}
+
+void* Renderer::materializeHTML(std::shared_ptr<VNode> vnode, void* container) {
+    CPPVUE_TRACE_SCOPE("Renderer::materializeHTML");
+    
+    std::string html;
+    serializeHTML(*vnode, html);
+    
+    auto nodes = platformRenderer_->insertHTML(container, nullptr, html);
+    if (nodes.size() != countMaterializedNodes(*vnode)) {
+        // Le parser a produit une autre structure : retour à la création nœud par nœud.
+        // La restructuration (<p><div>, foster-parenting des tables) peut créer plusieurs
+        // nœuds de premier niveau : tous ceux rattachés au conteneur sont retirés d'un coup.
+        platformRenderer_->removeChildren(container, nodes);
+        return nullptr;
+    }
+    
+    // Associe les nœuds créés aux VNodes et branche les événements
+    std::size_t index = 0;
+    bindMaterialized(vnode, *vnode, nodes, index);
+    return nodes.front();
+}
+
+void Renderer::bindMaterialized(std::shared_ptr<VNode> vnode,
+                               const VNode& shape,
+                               const std::vector<void*>& nodes,
+                               std::size_t& index) {
+    // shape décrit la structure réellement parsée (le squelette pour un clone)
+    CPPVUE_TRACE_VNODES(1);
+    void* element = nodes[index++];
+    
+    nodeToElement_[vnode] = element;
+    elementToNode_[element] = vnode;
+    rememberComponentRoot(vnode);
+    
+    if (vnode->tag.empty()) {
+        return;
+    }
+    if (shape.children.empty() && !shape.textContent.empty()) {
+        index++; // Nœud texte implicite, géré par setElementText
+    }
+    for (std::size_t i = 0; i < vnode->children.size(); ++i) {
+        bindMaterialized(vnode->children[i], *shape.children[i], nodes, index);
+    }
+    bindEvents(element, *vnode);
+}
+
+// Clonage des squelettes statiques
+
+namespace {
+    // Résout un chemin d'enfants depuis la racine d'un squelette
+    VNode* resolveSlot(VNode& root, const std::vector<int>& path) {
+        VNode* node = &root;
+        for (int index : path) {
+            if (index < 0 || static_cast<std::size_t>(index) >= node->children.size()) {
+                return nullptr;
+            }
+            node = node->children[index].get();
+        }
+        return node;
+    }
+    
+    std::shared_ptr<VNode> cloneStructure(const VNode& vnode) {
+        auto copy = VNode::create(vnode.tag, vnode.props, {}, vnode.textContent);
+        copy->children.reserve(vnode.children.size());
+        for (const auto& child : vnode.children) {
+            copy->children.push_back(cloneStructure(*child));
+        }
+        return copy;
+    }
+    
+    // Position préfixe d'un nœud dans la liste renvoyée par cloneTemplate
+    bool preorderIndex(const VNode& node, const VNode* target, std::size_t& index) {
+        if (&node == target) {
+            return true;
+        }
+        index++;
+        if (!node.tag.empty() && node.children.empty() && !node.textContent.empty()) {
+            index++;
+        }
+        for (const auto& child : node.children) {
+            if (preorderIndex(*child, target, index)) {
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+bool Renderer::matchesSkeleton(const VNode& vnode, const VNode& skeleton) const {
+    if (vnode.tag != skeleton.tag || vnode.children.size() != skeleton.children.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < vnode.children.size(); ++i) {
+        if (!matchesSkeleton(*vnode.children[i], *skeleton.children[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+Renderer::PreparedTemplate& Renderer::prepareTemplate(const StaticTemplateInfo& info,
+                                                      const VNode& instance) {
+    auto& prepared = templates_[info.id];
+    
+    // Le squelette reprend la première instance, emplacements dynamiques vidés
+    prepared.skeleton = cloneStructure(instance);
+    for (const auto& slot : info.slots) {
+        VNode* node = resolveSlot(*prepared.skeleton, slot.path);
+        if (!node) {
+            return prepared;
+        }
+        for (const auto& name : slot.dynamicProps) {
+            node->props.erase(name);
+        }
+        if (slot.dynamicText) {
+            // Un nœud texte doit rester non vide pour exister après parsing
+            node->textContent = node->tag.empty() ? " " : "";
+        }
+    }
+    
+    if (!canMaterialize(*prepared.skeleton, true)) {
+        return prepared;
+    }
+    
+    for (const auto& slot : info.slots) {
+        std::size_t index = 0;
+        preorderIndex(*prepared.skeleton, resolveSlot(*prepared.skeleton, slot.path), index);
+        prepared.slotIndices.push_back(index);
+    }
+    prepared.nodeCount = countMaterializedNodes(*prepared.skeleton);
+    
+    std::string html;
+    serializeHTML(*prepared.skeleton, html);
+    prepared.handle = platformRenderer_->createTemplate(html);
+    return prepared;
+}
+
+void* Renderer::instantiateTemplate(std::shared_ptr<VNode> vnode) {
+    const auto* info = TemplateRegistry::instance().find(vnode->templateId);
+    if (!info) {
+        return nullptr;
+    }
+    
+    auto it = templates_.find(info->id);
+    auto& prepared = it != templates_.end() ? it->second : prepareTemplate(*info, *vnode);
+    if (!prepared.handle || !matchesSkeleton(*vnode, *prepared.skeleton)) {
+        return nullptr;
+    }
+    
+    CPPVUE_TRACE_SCOPE("Renderer::instantiateTemplate");
+    auto nodes = platformRenderer_->cloneTemplate(prepared.handle);
+    if (nodes.size() != prepared.nodeCount) {
+        // Le parser a modifié la structure : le squelette n'est plus utilisé
+        prepared.handle = nullptr;
+        return nullptr;
+    }
+    
+    std::size_t index = 0;
+    bindMaterialized(vnode, *prepared.skeleton, nodes, index);
+    
+    // Seuls les emplacements dynamiques sont mis à jour
+    for (std::size_t i = 0; i < info->slots.size(); ++i) {
+        const auto& slot = info->slots[i];
+        VNode* node = resolveSlot(*vnode, slot.path);
+        VNode* skeletonNode = resolveSlot(*prepared.skeleton, slot.path);
+        void* target = nodes[prepared.slotIndices[i]];
+        
+        if (!node->tag.empty()) {
+            updateDOMElement(target, skeletonNode->props, node->props);
+        }
+        if (slot.dynamicText && node->textContent != skeletonNode->textContent) {
+            if (node->tag.empty()) {
+                platformRenderer_->setText(target, node->textContent);
+            } else {
+                platformRenderer_->setElementText(target, node->textContent);
+            }
+        }
+    }
+    
+    return nodes.front();
+}
+
 void Renderer::patch(std::shared_ptr<VNode> oldNode, 
                     std::shared_ptr<VNode> newNode,
                     void* container) {
-    if (!isSameVNode(oldNode, newNode)) {
+    CPPVUE_TRACE_VNODES(1);
+
+    if (oldNode->tag.empty() && newNode->tag.empty()) {
+        // Chemin rapide : deux nœuds texte, au plus une écriture DOM
+        patchText(oldNode, newNode);
+    } else if (!isSameVNode(oldNode, newNode)) {
         // Les nœuds sont différents, remplace complètement
         auto oldElement = nodeToElement_[oldNode];
         auto newElement = createDOMElement(newNode);
@@ -99,24 +575,30 @@ void Renderer::patch(std::shared_ptr<VNode> oldNode,
         platformRenderer_->insertBefore(container, newElement, oldElement);
         platformRenderer_->removeChild(container, oldElement);
         
-        // Met à jour les caches
-        nodeToElement_.erase(oldNode);
-        elementToNode_.erase(oldElement);
-        nodeToElement_[newNode] = newElement;
-        elementToNode_[newElement] = newNode;
+        // Recycle l'ancien élément (ou nettoie ses caches)
+        releaseToPool(oldNode, oldElement);
     } else {
         // Les nœuds sont similaires, met à jour
         auto element = nodeToElement_[oldNode];
         
-        // Met à jour les props
+        // Met à jour les props et les listeners
         updateDOMElement(element, oldNode->props, newNode->props);
+        // Un handler .once déjà déclenché le reste sur le même élément
+        for (const auto& [handler, fired] : newNode->onceFired) {
+            auto old = oldNode->onceFired.find(handler);
+            if (old != oldNode->onceFired.end()) {
+                *fired = *old->second;
+            }
+        }
+        patchEvents(element, *newNode);
         
-        // Met à jour les enfants
-        patchChildren(oldNode, newNode, element);
+        // Met à jour le texte et les enfants
+        patchContent(oldNode, newNode, element);
         
         // Met à jour les caches
         nodeToElement_[newNode] = element;
         elementToNode_[element] = newNode;
+        rememberComponentRoot(newNode);
     }
 }
 
@@ -139,9 +621,65 @@ void Renderer::updateDOMElement(void* element,
     }
 }
 
+void Renderer::patchText(std::shared_ptr<VNode> oldNode, std::shared_ptr<VNode> newNode) {
+    auto element = nodeToElement_[oldNode];
+    
+    // Compare les chaînes avant de traverser le bridge
+    if (oldNode->textContent != newNode->textContent) {
+        platformRenderer_->setText(element, newNode->textContent);
+    }
+    
+    // Met à jour les caches
+    nodeToElement_.erase(oldNode);
+    nodeToElement_[newNode] = element;
+    elementToNode_[element] = newNode;
+}
+
+void Renderer::patchContent(std::shared_ptr<VNode> oldNode,
+                          std::shared_ptr<VNode> newNode,
+                          void* element) {
+    bool oldTextOnly = oldNode->children.empty() && !oldNode->textContent.empty();
+    bool newTextOnly = newNode->children.empty() && !newNode->textContent.empty();
+    
+    // c-html : le fragment remplace les enfants, réécrit seulement s'il a changé
+    if (newNode->innerHTML) {
+        if (oldNode->innerHTML != newNode->innerHTML || !oldNode->children.empty() || oldTextOnly) {
+            for (const auto& child : oldNode->children) {
+                forgetSubtree(child);
+            }
+            platformRenderer_->setElementHTML(element, *newNode->innerHTML);
+        }
+        return;
+    }
+    if (oldNode->innerHTML) {
+        platformRenderer_->setElementHTML(element, "");
+        oldTextOnly = false;
+    }
+    
+    if (newTextOnly) {
+        // setElementText remplace tous les enfants existants en une écriture
+        if (!oldNode->children.empty() || oldNode->textContent != newNode->textContent) {
+            for (const auto& child : oldNode->children) {
+                forgetSubtree(child);
+            }
+            platformRenderer_->setElementText(element, newNode->textContent);
+        }
+        return;
+    }
+    
+    // Le texte précédent doit disparaître avant d'ajouter des enfants
+    if (oldTextOnly) {
+        platformRenderer_->setElementText(element, "");
+    }
+    
+    patchChildren(oldNode, newNode, element);
+}
+
 void Renderer::patchChildren(std::shared_ptr<VNode> oldNode,
                            std::shared_ptr<VNode> newNode,
                            void* container) {
+    CPPVUE_TRACE_SCOPE("Renderer::patchChildren");
+
     const auto& oldChildren = oldNode->children;
     const auto& newChildren = newNode->children;
     
@@ -170,6 +708,10 @@ void Renderer::patchChildren(std::shared_ptr<VNode> oldNode,
         } else {
             // Cas plus complexes nécessitant des déplacements
             // TODO: Implémenter la réorganisation des nœuds
+            // En attendant, remplace le nœud de tête pour garantir la progression
+            patch(oldStartChild, newStartChild, container);
+            oldStartIdx++;
+            newStartIdx++;
         }
     }
     
@@ -186,10 +728,117 @@ void Renderer::patchChildren(std::shared_ptr<VNode> oldNode,
         auto oldChild = oldChildren[oldStartIdx];
         auto element = nodeToElement_[oldChild];
         platformRenderer_->removeChild(container, element);
+        releaseToPool(oldChild, element);
         oldStartIdx++;
     }
 }
 
+// Pool de recyclage des nœuds DOM
+
+void Renderer::enableNodePool(std::size_t maxPerTag) {
+    nodePoolCapacity_ = maxPerTag;
+}
+
+void Renderer::disableNodePool() {
+    nodePoolCapacity_ = 0;
+    for (auto& [tag, entries] : nodePool_) {
+        for (auto& entry : entries) {
+            forgetSubtree(entry.lastVNode);
+        }
+    }
+    nodePool_.clear();
+    nodePoolStats_.size = 0;
+}
+
+void* Renderer::acquireFromPool(std::shared_ptr<VNode> vnode) {
+    if (nodePoolCapacity_ == 0) {
+        return nullptr;
+    }
+    
+    auto it = nodePool_.find(vnode->tag);
+    if (it == nodePool_.end() || it->second.empty()) {
+        nodePoolStats_.misses++;
+        return nullptr;
+    }
+    
+    auto entry = std::move(it->second.back());
+    it->second.pop_back();
+    nodePoolStats_.size--;
+    nodePoolStats_.hits++;
+    
+    // Réinitialise l'élément par diff avec le dernier VNode rendu,
+    // sans effacer puis réappliquer tous les attributs
+    updateDOMElement(entry.element, entry.lastVNode->props, vnode->props);
+    patchEvents(entry.element, *vnode);
+    patchContent(entry.lastVNode, vnode, entry.element);
+    
+    nodeToElement_.erase(entry.lastVNode);
+    return entry.element;
+}
+
+void Renderer::releaseToPool(std::shared_ptr<VNode> vnode, void* element) {
+    elementToNode_.erase(element);
+    forgetComponentRoot(vnode);
+    
+    // Les nœuds texte et le mode sans pool ne sont pas recyclés
+    if (nodePoolCapacity_ == 0 || vnode->tag.empty()) {
+        forgetSubtree(vnode);
+        return;
+    }
+    
+    auto& entries = nodePool_[vnode->tag];
+    if (entries.size() >= nodePoolCapacity_) {
+        nodePoolStats_.evicted++;
+        forgetSubtree(vnode);
+        return;
+    }
+    
+    // Le VNode est conservé comme référence pour le diff de réutilisation ;
+    // les caches de ses enfants restent valides pour patchChildren
+    entries.push_back({element, vnode});
+    nodePoolStats_.size++;
+    nodePoolStats_.released++;
+}
+
+void Renderer::forgetSubtree(std::shared_ptr<VNode> vnode) {
+    auto it = nodeToElement_.find(vnode);
+    if (it != nodeToElement_.end()) {
+        auto owner = elementToNode_.find(it->second);
+        if (owner == elementToNode_.end() || owner->second == vnode) {
+            // Élément abandonné (pas repris par un autre VNode) : ses dispatchers aussi
+            if (owner != elementToNode_.end()) {
+                elementToNode_.erase(owner);
+            }
+            listeners_.erase(it->second);
+        }
+        nodeToElement_.erase(it);
+    }
+    forgetComponentRoot(vnode);
+    for (const auto& child : vnode->children) {
+        forgetSubtree(child);
+    }
+}
+
+void Renderer::rememberComponentRoot(const std::shared_ptr<VNode>& vnode) {
+    if (auto component = vnode->component.lock()) {
+        componentRoots_[component.get()] = vnode;
+    }
+}
+
+void Renderer::forgetComponentRoot(const std::shared_ptr<VNode>& vnode) {
+    if (auto component = vnode->component.lock()) {
+        auto it = componentRoots_.find(component.get());
+        if (it != componentRoots_.end() && it->second == vnode) {
+            componentRoots_.erase(it);
+        }
+    }
+}
+
+double NodePoolStats::hitRate() const {
+    auto total = hits + misses;
+    return total == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(total);
+}
+
 bool Renderer::isSameVNode(std::shared_ptr<VNode> n1, std::shared_ptr<VNode> n2) {
     return n1->tag == n2->tag && n1->key == n2->key;
 }
@@ -218,6 +867,18 @@ void WebRenderer::setProperty(void* element, const std::string& name, const std:
     // TODO: Implémenter l'appel à JavaScript via WebAssembly
 }
 
+void WebRenderer::setText(void* node, const std::string& text) {
+    // TODO: Implémenter l'appel à JavaScript via WebAssembly (JsBridge::setText)
+}
+
+void WebRenderer::setElementText(void* element, const std::string& text) {
+    // TODO: Implémenter l'appel à JavaScript via WebAssembly (JsBridge::setElementText)
+}
+
+void WebRenderer::setElementHTML(void* element, const std::string& html) {
+    // TODO: Implémenter l'appel à JavaScript via WebAssembly (JsBridge::setElementHTML)
+}
+
 void WebRenderer::insertBefore(void* parent, void* newNode, void* referenceNode) {
     // TODO: Implémenter l'appel à JavaScript via WebAssembly
 }
@@ -230,6 +891,30 @@ void WebRenderer::appendChild(void* parent, void* child) {
     // TODO: Implémenter l'appel à JavaScript via WebAssembly
 }
 
+void* WebRenderer::parentNode(void* node) {
+    // TODO: Implémenter l'appel à JavaScript via WebAssembly
+    return nullptr;
+}
+
+std::vector<void*> WebRenderer::insertHTML(void* parent, void* referenceNode, const std::string& html) {
+    // TODO: Implémenter l'appel à JavaScript via WebAssembly (JsBridge::insertHTML)
+    return {};
+}
+
+void WebRenderer::removeChildren(void* parent, const std::vector<void*>& nodes) {
+    // TODO: Implémenter l'appel à JavaScript via WebAssembly (JsBridge::removeChildren)
+}
+
+void* WebRenderer::createTemplate(const std::string& html) {
+    // TODO: Implémenter l'appel à JavaScript via WebAssembly (JsBridge::createTemplate)
+    return nullptr;
+}
+
+std::vector<void*> WebRenderer::cloneTemplate(void* templateHandle) {
+    // TODO: Implémenter l'appel à JavaScript via WebAssembly (JsBridge::cloneTemplate)
+    return {};
+}
+
 void WebRenderer::addEventListener(void* element,
                                  const std::string& event,
                                  std::function<void(void*)> callback) {
@@ -242,4 +927,107 @@ void WebRenderer::removeEventListener(void* element,
     // TODO: Implémenter l'appel à JavaScript via WebAssembly
 }
 
+#ifdef CPPVUE_ENABLE_PROFILER
+
+// Implémentation de TracingPlatformRenderer
+
+TracingPlatformRenderer::TracingPlatformRenderer(std::unique_ptr<PlatformRenderer> inner)
+    : inner_(std::move(inner)) {}
+
+void* TracingPlatformRenderer::createElement(const std::string& tag) {
+    CPPVUE_TRACE_DOM_OP();
+    return inner_->createElement(tag);
+}
+
+void* TracingPlatformRenderer::createTextNode(const std::string& text) {
+    CPPVUE_TRACE_DOM_OP();
+    return inner_->createTextNode(text);
+}
+
+void TracingPlatformRenderer::setAttribute(void* element, const std::string& name, const std::string& value) {
+    CPPVUE_TRACE_DOM_OP();
+    inner_->setAttribute(element, name, value);
+}
+
+void TracingPlatformRenderer::removeAttribute(void* element, const std::string& name) {
+    CPPVUE_TRACE_DOM_OP();
+    inner_->removeAttribute(element, name);
+}
+
+void TracingPlatformRenderer::setProperty(void* element, const std::string& name, const std::any& value) {
+    CPPVUE_TRACE_DOM_OP();
+    inner_->setProperty(element, name, value);
+}
+
+void TracingPlatformRenderer::setText(void* node, const std::string& text) {
+    CPPVUE_TRACE_DOM_OP();
+    inner_->setText(node, text);
+}
+
+void TracingPlatformRenderer::setElementText(void* element, const std::string& text) {
+    CPPVUE_TRACE_DOM_OP();
+    inner_->setElementText(element, text);
+}
+
+void TracingPlatformRenderer::setElementHTML(void* element, const std::string& html) {
+    CPPVUE_TRACE_DOM_OP();
+    inner_->setElementHTML(element, html);
+}
+
+void TracingPlatformRenderer::insertBefore(void* parent, void* newNode, void* referenceNode) {
+    CPPVUE_TRACE_DOM_OP();
+    inner_->insertBefore(parent, newNode, referenceNode);
+}
+
+void TracingPlatformRenderer::removeChild(void* parent, void* child) {
+    CPPVUE_TRACE_DOM_OP();
+    inner_->removeChild(parent, child);
+}
+
+void TracingPlatformRenderer::appendChild(void* parent, void* child) {
+    CPPVUE_TRACE_DOM_OP();
+    inner_->appendChild(parent, child);
+}
+
+void* TracingPlatformRenderer::parentNode(void* node) {
+    CPPVUE_TRACE_DOM_OP();
+    return inner_->parentNode(node);
+}
+
+std::vector<void*> TracingPlatformRenderer::insertHTML(void* parent, void* referenceNode, const std::string& html) {
+    CPPVUE_TRACE_DOM_OP();
+    return inner_->insertHTML(parent, referenceNode, html);
+}
+
+void TracingPlatformRenderer::removeChildren(void* parent, const std::vector<void*>& nodes) {
+    CPPVUE_TRACE_DOM_OP();
+    inner_->removeChildren(parent, nodes);
+}
+
+void* TracingPlatformRenderer::createTemplate(const std::string& html) {
+    CPPVUE_TRACE_DOM_OP();
+    return inner_->createTemplate(html);
+}
+
+std::vector<void*> TracingPlatformRenderer::cloneTemplate(void* templateHandle) {
+    CPPVUE_TRACE_DOM_OP();
+    return inner_->cloneTemplate(templateHandle);
+}
+
+void TracingPlatformRenderer::addEventListener(void* element,
+                                             const std::string& event,
+                                             std::function<void(void*)> callback) {
+    CPPVUE_TRACE_DOM_OP();
+    inner_->addEventListener(element, event, std::move(callback));
+}
+
+void TracingPlatformRenderer::removeEventListener(void* element,
+                                                const std::string& event,
+                                                std::function<void(void*)> callback) {
+    CPPVUE_TRACE_DOM_OP();
+    inner_->removeEventListener(element, event, std::move(callback));
+}
+
+#endif // CPPVUE_ENABLE_PROFILER
+
 } // namespace cppvue
@@ -1,10 +1,12 @@
 #pragma once
 
 #include "component.hpp"
+#include "static_template.hpp"
 #include <memory>
 #include <string>
 #include <functional>
 #include <unordered_map>
+#include <vector>
 
 namespace cppvue {
 
@@ -26,10 +28,28 @@ public:
     virtual void removeAttribute(void* element, const std::string& name) = 0;
     virtual void setProperty(void* element, const std::string& name, const std::any& value) = 0;
     
+    // Contenu texte
+    virtual void setText(void* node, const std::string& text) = 0;
+    virtual void setElementText(void* element, const std::string& text) = 0;
+    // Remplace le contenu de l'élément par un fragment HTML non échappé (c-html)
+    virtual void setElementHTML(void* element, const std::string& html) = 0;
+    
     // Manipulation du DOM
     virtual void insertBefore(void* parent, void* newNode, void* referenceNode) = 0;
     virtual void removeChild(void* parent, void* child) = 0;
     virtual void appendChild(void* parent, void* child) = 0;
+    virtual void* parentNode(void* node) = 0;
+    
+    // Insère un fragment HTML en une seule traversée du bridge (avant referenceNode,
+    // ou en fin de parent si nul) et renvoie les nœuds élément/texte créés en ordre préfixe
+    virtual std::vector<void*> insertHTML(void* parent, void* referenceNode, const std::string& html) = 0;
+    // Retire en une traversée ceux des nœuds qui sont des enfants directs de parent
+    virtual void removeChildren(void* parent, const std::vector<void*>& nodes) = 0;
+    
+    // Squelettes statiques : un <template> côté web, un arbre détaché conservé en natif.
+    // cloneTemplate fait un cloneNode(true) et renvoie les nœuds du clone en ordre préfixe
+    virtual void* createTemplate(const std::string& html) = 0;
+    virtual std::vector<void*> cloneTemplate(void* templateHandle) = 0;
     
     // Événements
     virtual void addEventListener(void* element, 
@@ -40,6 +60,17 @@ public:
                                    std::function<void(void*)> callback) = 0;
 };
 
+// Statistiques du pool de recyclage des nœuds DOM
+struct NodePoolStats {
+    std::size_t size = 0;      // Éléments détachés actuellement en réserve
+    std::size_t hits = 0;      // Créations servies par le pool
+    std::size_t misses = 0;    // Créations ayant nécessité createElement
+    std::size_t released = 0;  // Éléments rendus au pool
+    std::size_t evicted = 0;   // Éléments abandonnés car le pool du tag était plein
+    
+    double hitRate() const;
+};
+
 // Classe principale du renderer
 class Renderer {
 public:
@@ -48,12 +79,21 @@ public:
     // Montage initial d'un composant
     void mount(std::shared_ptr<Component> component, void* container);
     
-    // Mise à jour d'un composant
+    // Mise à jour d'un composant monté, racine ou enfant : seul son sous-arbre
+    // est re-rendu et comparé
     void update(std::shared_ptr<Component> component);
     
     // Démontage d'un composant
     void unmount(std::shared_ptr<Component> component);
     
+    // Montage initial par sérialisation HTML (une traversée du bridge par sous-arbre)
+    void setHtmlMount(bool enabled) { htmlMount_ = enabled; }
+    
+    // Pool optionnel d'éléments détachés, par tag, utilisé par createDOMElement
+    void enableNodePool(std::size_t maxPerTag = 256);
+    void disableNodePool();
+    const NodePoolStats& nodePoolStats() const { return nodePoolStats_; }
+    
 private:
     // Algorithme de diff et patch
     void patch(std::shared_ptr<VNode> oldNode, 
@@ -71,6 +111,38 @@ private:
     void updateComponent(std::shared_ptr<Component> component);
     void unmountComponent(std::shared_ptr<Component> component);
     
+    // Matérialisation HTML du montage initial
+    // nesting : groupes de balises auto-fermantes ouverts par les ancêtres (<a>, <li>...)
+    bool canMaterialize(const VNode& vnode, bool inTemplate = false, unsigned nesting = 0) const;
+    void serializeHTML(const VNode& vnode, std::string& out) const;
+    std::size_t countMaterializedNodes(const VNode& vnode) const;
+    void* materializeHTML(std::shared_ptr<VNode> vnode, void* container);
+    void bindMaterialized(std::shared_ptr<VNode> vnode,
+                         const VNode& shape,
+                         const std::vector<void*>& nodes,
+                         std::size_t& index);
+    void bindEvents(void* element, const VNode& vnode);
+    // Élément réutilisé : les closures de newNode remplacent celles du rendu
+    // précédent ; le bridge n'est traversé que pour un événement ajouté ou retiré
+    void patchEvents(void* element, const VNode& newNode);
+    
+    // Instanciation des squelettes statiques par clonage
+    struct PreparedTemplate {
+        void* handle = nullptr;                 // Nul si le squelette n'est pas clonable
+        std::shared_ptr<VNode> skeleton;        // Structure statique, emplacements vidés
+        std::vector<std::size_t> slotIndices;   // Position préfixe de chaque emplacement
+        std::size_t nodeCount = 0;
+    };
+    void* instantiateTemplate(std::shared_ptr<VNode> vnode);
+    PreparedTemplate& prepareTemplate(const StaticTemplateInfo& info, const VNode& instance);
+    bool matchesSkeleton(const VNode& vnode, const VNode& skeleton) const;
+    
+    // Chemins rapides pour le contenu texte
+    void patchText(std::shared_ptr<VNode> oldNode, std::shared_ptr<VNode> newNode);
+    void patchContent(std::shared_ptr<VNode> oldNode,
+                     std::shared_ptr<VNode> newNode,
+                     void* element);
+    
     // Helpers
     bool isSameVNode(std::shared_ptr<VNode> n1, std::shared_ptr<VNode> n2);
     void patchChildren(std::shared_ptr<VNode> oldNode, 
@@ -82,10 +154,45 @@ private:
                     const std::unordered_map<std::string, std::any>& oldEvents,
                     const std::unordered_map<std::string, std::any>& newEvents);
     
+    // Recyclage des éléments DOM
+    void* acquireFromPool(std::shared_ptr<VNode> vnode);
+    void releaseToPool(std::shared_ptr<VNode> vnode, void* element);
+    void forgetSubtree(std::shared_ptr<VNode> vnode);
+    
+    // Dernier VNode racine rendu par chaque composant
+    void rememberComponentRoot(const std::shared_ptr<VNode>& vnode);
+    void forgetComponentRoot(const std::shared_ptr<VNode>& vnode);
+    
     // Cache pour les éléments DOM
     std::unordered_map<std::shared_ptr<VNode>, void*> nodeToElement_;
     std::unordered_map<void*, std::shared_ptr<VNode>> elementToNode_;
     
+    // Le VNode racine d'un composant enfant est aussi référencé par l'arbre de
+    // son parent : update() le met à jour sur place
+    std::unordered_map<const Component*, std::shared_ptr<VNode>> componentRoots_;
+    
+    // Pool d'éléments détachés, avec le dernier VNode rendu pour le diff
+    struct PooledNode {
+        void* element;
+        std::shared_ptr<VNode> lastVNode;
+    };
+    std::unordered_map<std::string, std::vector<PooledNode>> nodePool_;
+    std::size_t nodePoolCapacity_ = 0;  // 0 = pool désactivé
+    NodePoolStats nodePoolStats_;
+    
+    // Un dispatcher par (élément, événement), attaché une seule fois : il appelle
+    // la closure courante, que patchEvents remplace sur place
+    struct EventListener {
+        std::shared_ptr<std::function<void(void*)>> handler;
+        std::function<void(void*)> dispatcher;  // Instance passée au PlatformRenderer
+    };
+    std::unordered_map<void*, std::unordered_map<std::string, EventListener>> listeners_;
+    
+    bool htmlMount_ = false;
+    
+    // Squelettes statiques préparés, par identifiant de TemplateRegistry
+    std::unordered_map<int, PreparedTemplate> templates_;
+    
     // Renderer spécifique à la plateforme
     std::unique_ptr<PlatformRenderer> platformRenderer_;
 };
@@ -98,9 +205,17 @@ public:
     void setAttribute(void* element, const std::string& name, const std::string& value) override;
     void removeAttribute(void* element, const std::string& name) override;
     void setProperty(void* element, const std::string& name, const std::any& value) override;
+    void setText(void* node, const std::string& text) override;
+    void setElementText(void* element, const std::string& text) override;
+    void setElementHTML(void* element, const std::string& html) override;
     void insertBefore(void* parent, void* newNode, void* referenceNode) override;
     void removeChild(void* parent, void* child) override;
     void appendChild(void* parent, void* child) override;
+    void* parentNode(void* node) override;
+    std::vector<void*> insertHTML(void* parent, void* referenceNode, const std::string& html) override;
+    void removeChildren(void* parent, const std::vector<void*>& nodes) override;
+    void* createTemplate(const std::string& html) override;
+    std::vector<void*> cloneTemplate(void* templateHandle) override;
     void addEventListener(void* element, 
                         const std::string& event,
                         std::function<void(void*)> callback) override;
@@ -114,4 +229,38 @@ private:
     static std::any deserializeValue(const std::string& value);
 };
 
+#ifdef CPPVUE_ENABLE_PROFILER
+// Décorateur comptant les opérations DOM pour le profiler
+class TracingPlatformRenderer : public PlatformRenderer {
+public:
+    explicit TracingPlatformRenderer(std::unique_ptr<PlatformRenderer> inner);
+    
+    void* createElement(const std::string& tag) override;
+    void* createTextNode(const std::string& text) override;
+    void setAttribute(void* element, const std::string& name, const std::string& value) override;
+    void removeAttribute(void* element, const std::string& name) override;
+    void setProperty(void* element, const std::string& name, const std::any& value) override;
+    void setText(void* node, const std::string& text) override;
+    void setElementText(void* element, const std::string& text) override;
+    void setElementHTML(void* element, const std::string& html) override;
+    void insertBefore(void* parent, void* newNode, void* referenceNode) override;
+    void removeChild(void* parent, void* child) override;
+    void appendChild(void* parent, void* child) override;
+    void* parentNode(void* node) override;
+    std::vector<void*> insertHTML(void* parent, void* referenceNode, const std::string& html) override;
+    void removeChildren(void* parent, const std::vector<void*>& nodes) override;
+    void* createTemplate(const std::string& html) override;
+    std::vector<void*> cloneTemplate(void* templateHandle) override;
+    void addEventListener(void* element, 
+                        const std::string& event,
+                        std::function<void(void*)> callback) override;
+    void removeEventListener(void* element,
+                           const std::string& event,
+                           std::function<void(void*)> callback) override;
+    
+private:
+    std::unique_ptr<PlatformRenderer> inner_;
+};
+#endif
+
 } // namespace cppvue
@@ -108,17 +108,23 @@ bool Router::matchRoute(const std::string& pattern, const std::string& path) {
     return pathIndex == pathSegments.size();
 }
 
+const Route* Router::findRoute(const std::string& path) {
+    for (const auto& route : routes_) {
+        if (matchRoute(route.path, path)) {
+            return &route;
+        }
+    }
+    return nullptr;
+}
+
 void Router::push(const std::string& path) {
     // Vérifie les guards de navigation
     const auto& oldRoute = *currentRoute_;
     Route newRoute;
     
     // Trouve la nouvelle route
-    for (const auto& route : routes_) {
-        if (matchRoute(route.path, path)) {
-            newRoute = route;
-            break;
-        }
+    if (const auto* route = findRoute(path)) {
+        newRoute = *route;
     }
     
     // Exécute les guards de navigation
@@ -131,11 +137,33 @@ void Router::push(const std::string& path) {
     // Met à jour le chemin et la route
     currentPath_ = path;
     updateCurrentRoute();
+    loadRoute(newRoute);
     
     // Met à jour l'URL du navigateur
     updateBrowserHistory(path);
 }
 
+void Router::loadRoute(const Route& route) {
+    // Les préchargements attendent le chunk de la route affichée, prioritaire
+    auto prefetch = [chunks = route.prefetch](bool) {
+        for (const auto& chunk : chunks) {
+            ModuleLoader::instance().prefetch(chunk);
+        }
+    };
+    if (route.lazyComponent.empty()) {
+        prefetch(true);
+    } else {
+        ModuleLoader::instance().loadComponent(route.lazyComponent, std::move(prefetch));
+    }
+}
+
+void Router::prefetch(const std::string& path) {
+    const auto* route = findRoute(path);
+    if (route != nullptr && !route->lazyComponent.empty()) {
+        ModuleLoader::instance().loadComponent(route->lazyComponent);
+    }
+}
+
 void Router::updateBrowserHistory(const std::string& path) {
     // TODO: Implémenter l'interaction avec l'historique du navigateur via WebAssembly
 }
@@ -146,18 +174,42 @@ void Router::initializeFromBrowser() {
 
 // Implémentation de RouterView
 
+namespace {
+    std::shared_ptr<VNode> routerViewMessage(const std::string& cssClass, const std::string& text) {
+        return VNode::create("div", {{"class", cssClass}}, {}, text);
+    }
+}
+
 std::shared_ptr<VNode> RouterView::render() {
     const auto& currentRoute = Router::instance().currentRoute();
     
+    // Route d'un chunk : attente tant que son module n'est pas chargé (l'état
+    // est une dépendance réactive, le rendu est rejoué à la fin du chargement)
+    if (!currentRoute->lazyComponent.empty()) {
+        auto& loader = ModuleLoader::instance();
+        switch (loader.componentState(currentRoute->lazyComponent)) {
+            case ModuleLoader::State::LOADED:
+                if (auto component = loader.create(currentRoute->lazyComponent)) {
+                    return component->render();
+                }
+                [[fallthrough]];
+            case ModuleLoader::State::FAILED:
+                return routerViewMessage("router-view-error", "Failed to load component");
+            default:
+                if (currentRoute->loading) {
+                    return currentRoute->loading()->render();
+                }
+                return h("div", {{"class", "router-view-loading"}});
+        }
+    }
+    
     if (!currentRoute->component) {
-        return createVNode("div", {{"class", "router-view-error"}},
-                         {createTextVNode("404 Not Found")});
+        return routerViewMessage("router-view-error", "404 Not Found");
     }
     
     auto component = currentRoute->component();
     if (!component) {
-        return createVNode("div", {{"class", "router-view-error"}},
-                         {createTextVNode("Failed to load component")});
+        return routerViewMessage("router-view-error", "Failed to load component");
     }
     
     return component->render();
@@ -166,16 +218,17 @@ std::shared_ptr<VNode> RouterView::render() {
 // Implémentation de RouterLink
 
 std::shared_ptr<VNode> RouterLink::render() {
-    auto router = Router::instance();
+    auto& router = Router::instance();
     bool isActive = router.currentPath()->find(to_) == 0;
     
-    return createVNode("a",
-        {
-            {"href", to_},
-            {"class", isActive ? "router-link-active" : ""},
-            {"@click", [this](const std::any&) { navigate(); }}
-        },
-        slots_["default"] ? slots_["default"]() : std::vector<std::shared_ptr<VNode>>());
+    std::vector<std::shared_ptr<VNode>> children;
+    if (auto slot = getSlot("default")) {
+        children.push_back(slot->render());
+    }
+    auto link = h("a", {{"href", to_}, {"class", isActive ? "router-link-active" : ""}}, children);
+    link->events["click"] = std::function<void(void*)>([this](void*) { navigate(); });
+    link->events["mouseenter"] = std::function<void(void*)>([this](void*) { Router::instance().prefetch(to_); });
+    return link;
 }
 
 void RouterLink::navigate() {
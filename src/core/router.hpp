@@ -1,6 +1,7 @@
 #pragma once
 
 #include "component.hpp"
+#include "module_loader.hpp"
 #include "reactive.hpp"
 #include <string>
 #include <vector>
@@ -14,8 +15,32 @@ struct Route {
     std::string name;
     std::function<std::shared_ptr<Component>()> component;
     std::unordered_map<std::string, std::string> meta;
+
+    // Route chargée à la demande : composant d'un chunk (cvuec --lazy-chunks),
+    // créé par ModuleLoader une fois son module chargé
+    std::string lazyComponent;
+    // Rendu pendant le chargement (nul : <div class="router-view-loading">)
+    std::function<std::shared_ptr<Component>()> loading;
+    // Chunks préchargés une fois la route affichée (navigations probables)
+    std::vector<std::string> prefetch;
+
+    // Égalité sur la définition de la route (les fabriques ne sont pas
+    // comparables) : currentRoute_ ne notifie que si la route change
+    bool operator==(const Route& other) const {
+        return path == other.path && name == other.name && meta == other.meta &&
+               lazyComponent == other.lazyComponent && prefetch == other.prefetch;
+    }
 };
 
+// Route dont le composant vient d'un chunk chargé à la demande
+inline Route lazyRoute(std::string path, std::string component, std::vector<std::string> prefetch = {}) {
+    Route route;
+    route.path = std::move(path);
+    route.lazyComponent = std::move(component);
+    route.prefetch = std::move(prefetch);
+    return route;
+}
+
 class Router {
 public:
     static Router& instance() {
@@ -28,11 +53,12 @@ public:
         routes_.push_back(std::move(route));
     }
 
-    // Navigation programmatique
-    void push(const std::string& path) {
-        currentPath_ = path;
-        updateCurrentRoute();
-    }
+    // Navigation programmatique ; le chunk d'une route lazyComponent est chargé
+    // (RouterView affiche l'attente), puis les chunks de route.prefetch
+    void push(const std::string& path);
+
+    // Précharge le chunk de la route de path (survol d'un RouterLink...)
+    void prefetch(const std::string& path);
 
     void replace(const std::string& path) {
         push(path);
@@ -61,6 +87,10 @@ private:
     }
 
     bool matchRoute(const std::string& pattern, const std::string& path);
+    const Route* findRoute(const std::string& path);
+    void loadRoute(const Route& route);
+    void updateBrowserHistory(const std::string& path);
+    void initializeFromBrowser();
 
     std::vector<Route> routes_;
     Reactive<std::string> currentPath_;
@@ -80,13 +110,7 @@ inline auto createRouter(const std::vector<Route>& routes) {
 // Composant RouterView
 class RouterView : public Component {
 public:
-    std::shared_ptr<VNode> render() override {
-        const auto& currentRoute = Router::instance().currentRoute();
-        if (auto component = currentRoute->component()) {
-            return component->render();
-        }
-        return h("div", "404 Not Found");
-    }
+    std::shared_ptr<VNode> render() override;
 };
 
 // Composant RouterLink
@@ -94,17 +118,10 @@ class RouterLink : public Component {
 public:
     explicit RouterLink(std::string to) : to_(std::move(to)) {}
 
-    std::shared_ptr<VNode> render() override {
-        return h("a", 
-            {{"href", to_}, {"@click", "navigate"}},
-            {h("slot")}
-        );
-    }
+    std::shared_ptr<VNode> render() override;
 
 private:
-    void navigate() {
-        Router::instance().push(to_);
-    }
+    void navigate();
 
     std::string to_;
 };
@@ -0,0 +1,102 @@
+#include "static_template.hpp"
+#include "component.hpp"
+
+namespace cppvue {
+
+namespace {
+    // Format écrit par RenderCodeGenerator : longueurs en varint LEB128
+    std::size_t readVarint(std::string_view blob, std::size_t& pos) {
+        std::size_t value = 0;
+        int shift = 0;
+        while (pos < blob.size()) {
+            auto byte = static_cast<unsigned char>(blob[pos++]);
+            value |= static_cast<std::size_t>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0) {
+                break;
+            }
+            shift += 7;
+        }
+        return value;
+    }
+
+    std::string readString(std::string_view blob, std::size_t& pos) {
+        std::size_t size = readVarint(blob, pos);
+        std::string value(blob.substr(pos, size));
+        pos += size;
+        return value;
+    }
+
+    void readProps(std::string_view blob, std::size_t& pos, std::string_view scopeAttribute,
+                   std::unordered_map<std::string, std::string>& props) {
+        std::size_t count = readVarint(blob, pos);
+        props.reserve(count + (scopeAttribute.empty() ? 0 : 1));
+        for (std::size_t i = 0; i < count; ++i) {
+            std::string name = readString(blob, pos);
+            props.emplace(std::move(name), readString(blob, pos));
+        }
+        if (!scopeAttribute.empty()) {
+            props.emplace(std::string(scopeAttribute), std::string());
+        }
+    }
+
+    std::shared_ptr<VNode> readNode(std::string_view blob, std::size_t& pos, std::string_view scopeAttribute) {
+        auto node = std::make_shared<VNode>();
+        if (pos >= blob.size()) {
+            return node;
+        }
+        if (blob[pos++] == 'T') {
+            node->textContent = readString(blob, pos);
+            return node;
+        }
+        node->tag = readString(blob, pos);
+        readProps(blob, pos, scopeAttribute, node->props);
+        std::size_t count = readVarint(blob, pos);
+        node->children.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            node->children.push_back(readNode(blob, pos, scopeAttribute));
+        }
+        return node;
+    }
+}
+
+int TemplateRegistry::registerTemplate(std::uint64_t hash, std::vector<TemplateSlot> slots) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = idsByHash_.find(hash);
+    if (it != idsByHash_.end()) {
+        return it->second;
+    }
+
+    int id = static_cast<int>(templates_.size());
+    templates_.push_back(std::make_unique<StaticTemplateInfo>(
+        StaticTemplateInfo{id, hash, std::move(slots)}));
+    idsByHash_[hash] = id;
+    return id;
+}
+
+const StaticTemplateInfo* TemplateRegistry::find(int id) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (id < 0 || static_cast<std::size_t>(id) >= templates_.size()) {
+        return nullptr;
+    }
+    return templates_[id].get();
+}
+
+std::shared_ptr<VNode> withTemplate(std::shared_ptr<VNode> vnode, int templateId) {
+    vnode->templateId = templateId;
+    return vnode;
+}
+
+std::shared_ptr<VNode> staticTree(std::string_view blob, std::string_view scopeAttribute) {
+    std::size_t pos = 0;
+    return readNode(blob, pos, scopeAttribute);
+}
+
+std::unordered_map<std::string, std::string> staticProps(std::string_view blob, std::string_view scopeAttribute) {
+    std::unordered_map<std::string, std::string> props;
+    std::size_t pos = 0;
+    readProps(blob, pos, scopeAttribute, props);
+    return props;
+}
+
+} // namespace cppvue
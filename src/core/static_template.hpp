@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace cppvue {
+
+class VNode;
+
+// Emplacement dynamique d'un squelette statique, repéré par son chemin d'enfants
+struct TemplateSlot {
+    std::vector<int> path;                  // Indices d'enfants depuis la racine du squelette
+    std::vector<std::string> dynamicProps;  // Attributs liés (:prop, c-model, c-show)
+    bool dynamicText = false;               // Contenu texte interpolé
+};
+
+// Squelette statique enregistré par le code généré
+struct StaticTemplateInfo {
+    int id;
+    std::uint64_t hash;
+    std::vector<TemplateSlot> slots;
+};
+
+// Registre global des squelettes statiques (une entrée par structure distincte)
+class TemplateRegistry {
+public:
+    static TemplateRegistry& instance() {
+        static TemplateRegistry registry;
+        return registry;
+    }
+
+    // Enregistre un squelette ; un hash déjà connu renvoie l'identifiant existant
+    int registerTemplate(std::uint64_t hash, std::vector<TemplateSlot> slots);
+
+    // Recherche par identifiant (nul si inconnu)
+    const StaticTemplateInfo* find(int id) const;
+
+private:
+    TemplateRegistry() = default;
+
+    mutable std::mutex mutex_;
+    std::vector<std::unique_ptr<StaticTemplateInfo>> templates_;
+    std::unordered_map<std::uint64_t, int> idsByHash_;
+};
+
+// Marque un VNode comme instance d'un squelette statique
+std::shared_ptr<VNode> withTemplate(std::shared_ptr<VNode> vnode, int templateId);
+
+// Sous-arbre statique encodé par cvuec --compact (blob partagé entre composants) ;
+// scopeAttribute (data-v-id de <style scoped>) est posé sur chaque élément
+std::shared_ptr<VNode> staticTree(std::string_view blob, std::string_view scopeAttribute = {});
+
+// Attributs statiques d'un élément encodés par cvuec --compact
+std::unordered_map<std::string, std::string> staticProps(std::string_view blob,
+                                                         std::string_view scopeAttribute = {});
+
+} // namespace cppvue
@@ -0,0 +1,174 @@
+#include "value.hpp"
+#include <sstream>
+#include <stdexcept>
+
+namespace cppvue {
+
+Symbol SymbolTable::intern(std::string_view name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = symbols_.find(name);
+    if (it != symbols_.end()) {
+        return it->second;
+    }
+    auto symbol = static_cast<Symbol>(names_.size());
+    const std::string& stored = names_.emplace_back(name);
+    symbols_.emplace(stored, symbol);
+    return symbol;
+}
+
+const std::string& SymbolTable::name(Symbol symbol) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return names_.at(symbol);
+}
+
+Value::Value(std::string value)
+    : type_(Type::STRING), integer_(0), heap_(std::make_shared<const std::string>(std::move(value))) {}
+
+Value::Value(Array value)
+    : type_(Type::ARRAY), integer_(0), heap_(std::make_shared<const Array>(std::move(value))) {}
+
+Value::Value(Object value)
+    : type_(Type::OBJECT), integer_(0), heap_(std::make_shared<const Object>(std::move(value))) {}
+
+Value::Value(Function value)
+    : type_(Type::FUNCTION), integer_(0), heap_(std::make_shared<const Function>(std::move(value))) {}
+
+Value Value::opaque(std::any value) {
+    Value result;
+    result.type_ = Type::OPAQUE;
+    result.heap_ = std::make_shared<const std::any>(std::move(value));
+    return result;
+}
+
+Value Value::fromAny(const std::any& value) {
+    const auto& type = value.type();
+    if (!value.has_value()) return {};
+    if (type == typeid(Value)) return std::any_cast<const Value&>(value);
+    if (type == typeid(bool)) return std::any_cast<bool>(value);
+    if (type == typeid(int)) return std::any_cast<int>(value);
+    if (type == typeid(long)) return std::any_cast<long>(value);
+    if (type == typeid(long long)) return std::any_cast<long long>(value);
+    if (type == typeid(unsigned)) return std::any_cast<unsigned>(value);
+    if (type == typeid(unsigned long)) return std::any_cast<unsigned long>(value);
+    if (type == typeid(unsigned long long)) return std::any_cast<unsigned long long>(value);
+    if (type == typeid(double)) return std::any_cast<double>(value);
+    if (type == typeid(float)) return std::any_cast<float>(value);
+    if (type == typeid(std::string)) return std::any_cast<const std::string&>(value);
+    if (type == typeid(const char*)) return std::any_cast<const char*>(value);
+    if (type == typeid(Array)) return std::any_cast<const Array&>(value);
+    if (type == typeid(Object)) return std::any_cast<const Object&>(value);
+    if (type == typeid(Function)) return std::any_cast<const Function&>(value);
+    if (type == typeid(std::vector<std::any>)) {
+        const auto& items = std::any_cast<const std::vector<std::any>&>(value);
+        Array array;
+        array.reserve(items.size());
+        for (const auto& item : items) {
+            array.push_back(fromAny(item));
+        }
+        return array;
+    }
+    return opaque(value);
+}
+
+std::any Value::toAny() const {
+    switch (type_) {
+        case Type::NULL_VALUE: return {};
+        case Type::BOOLEAN: return boolean_;
+        case Type::INTEGER: return static_cast<long long>(integer_);
+        case Type::NUMBER: return number_;
+        case Type::STRING: return string();
+        case Type::ARRAY: return array();
+        case Type::OBJECT: return object();
+        case Type::FUNCTION: return function();
+        case Type::OPAQUE: return opaqueValue();
+    }
+    return {};
+}
+
+bool Value::toBoolean() const {
+    switch (type_) {
+        case Type::NULL_VALUE: return false;
+        case Type::BOOLEAN: return boolean_;
+        case Type::INTEGER: return integer_ != 0;
+        case Type::NUMBER: return number_ != 0.0 && number_ == number_;
+        case Type::STRING: return !string().empty();
+        default: return true;
+    }
+}
+
+double Value::toNumber() const {
+    switch (type_) {
+        case Type::NULL_VALUE: return 0.0;
+        case Type::BOOLEAN: return boolean_ ? 1.0 : 0.0;
+        case Type::INTEGER: return static_cast<double>(integer_);
+        case Type::NUMBER: return number_;
+        default: throw std::runtime_error("Expression value is not a number");
+    }
+}
+
+std::int64_t Value::toInteger() const {
+    return type_ == Type::INTEGER ? integer_ : static_cast<std::int64_t>(toNumber());
+}
+
+std::string Value::toString() const {
+    switch (type_) {
+        case Type::BOOLEAN: return boolean_ ? "true" : "false";
+        case Type::INTEGER: return std::to_string(integer_);
+        case Type::NUMBER: {
+            std::ostringstream out;
+            out.precision(15);
+            out << number_;
+            return out.str();
+        }
+        case Type::STRING: return string();
+        default: return "";
+    }
+}
+
+Value Value::member(const std::string& name) const {
+    if (type_ == Type::OBJECT) {
+        auto it = object().find(name);
+        return it != object().end() ? it->second : Value();
+    }
+    if (name == "length") {
+        if (type_ == Type::ARRAY) return array().size();
+        if (type_ == Type::STRING) return string().size();
+    }
+    if (type_ == Type::NULL_VALUE) {
+        throw std::runtime_error("Cannot read property '" + name + "' of null");
+    }
+    return {};
+}
+
+Value Value::index(const Value& key) const {
+    if (key.isNumeric() && (type_ == Type::ARRAY || type_ == Type::STRING)) {
+        std::int64_t position = key.toInteger();
+        std::size_t size = type_ == Type::ARRAY ? array().size() : string().size();
+        if (position < 0 || static_cast<std::size_t>(position) >= size) {
+            return {};
+        }
+        if (type_ == Type::ARRAY) {
+            return array()[static_cast<std::size_t>(position)];
+        }
+        return std::string(1, string()[static_cast<std::size_t>(position)]);
+    }
+    return member(key.toString());
+}
+
+bool Value::equals(const Value& other) const {
+    if (isNull() || other.isNull()) {
+        return isNull() && other.isNull();
+    }
+    if (type_ == Type::INTEGER && other.type_ == Type::INTEGER) {
+        return integer_ == other.integer_;
+    }
+    if (isNumeric() && other.isNumeric()) {
+        return toNumber() == other.toNumber();
+    }
+    if (isString() && other.isString()) {
+        return string() == other.string();
+    }
+    return type_ == other.type_ && heap_ == other.heap_;
+}
+
+} // namespace cppvue
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <any>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace cppvue {
+
+// Nom interné : les identifiants des expressions et les variables exposées
+// sont comparés par entier plutôt que par chaîne
+using Symbol = std::uint32_t;
+
+class SymbolTable {
+public:
+    static SymbolTable& instance() {
+        static SymbolTable table;
+        return table;
+    }
+
+    Symbol intern(std::string_view name);
+    const std::string& name(Symbol symbol) const;
+
+private:
+    SymbolTable() = default;
+
+    mutable std::mutex mutex_;
+    std::deque<std::string> names_;  // deque : les références renvoyées par name() restent valides
+    std::unordered_map<std::string_view, Symbol> symbols_;
+};
+
+// Valeur manipulée par les expressions : étiquette + scalaire en ligne,
+// les types composites sont partagés (immuables) derrière un shared_ptr
+class Value {
+public:
+    enum class Type : std::uint8_t {
+        NULL_VALUE,
+        BOOLEAN,
+        INTEGER,
+        NUMBER,
+        STRING,
+        ARRAY,
+        OBJECT,
+        FUNCTION,
+        OPAQUE      // std::any d'un type inconnu (objet d'événement, struct du composant)
+    };
+
+    using Array = std::vector<Value>;
+    using Object = std::unordered_map<std::string, Value>;
+    using Function = std::function<Value(const std::vector<Value>& arguments)>;
+
+    Value() : integer_(0) {}
+    Value(std::nullptr_t) : Value() {}
+    Value(bool value) : type_(Type::BOOLEAN), boolean_(value) {}
+    template<typename T, std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>, int> = 0>
+    Value(T value) : type_(Type::INTEGER), integer_(static_cast<std::int64_t>(value)) {}
+    Value(double value) : type_(Type::NUMBER), number_(value) {}
+    Value(float value) : Value(static_cast<double>(value)) {}
+    Value(const char* value) : Value(std::string(value)) {}
+    Value(std::string value);
+    Value(Array value);
+    Value(Object value);
+    Value(Function value);
+
+    static Value opaque(std::any value);
+
+    // Conversion depuis/vers std::any (props, variables des composants)
+    static Value fromAny(const std::any& value);
+    std::any toAny() const;
+
+    Type type() const { return type_; }
+    bool isNull() const { return type_ == Type::NULL_VALUE; }
+    bool isInteger() const { return type_ == Type::INTEGER; }
+    bool isNumeric() const { return type_ == Type::INTEGER || type_ == Type::NUMBER || type_ == Type::BOOLEAN; }
+    bool isString() const { return type_ == Type::STRING; }
+
+    // Conversions à la JavaScript
+    bool toBoolean() const;
+    double toNumber() const;
+    std::int64_t toInteger() const;
+    std::string toString() const;
+
+    // Accès aux types composites (le type doit correspondre)
+    const std::string& string() const { return *static_cast<const std::string*>(heap_.get()); }
+    const Array& array() const { return *static_cast<const Array*>(heap_.get()); }
+    const Object& object() const { return *static_cast<const Object*>(heap_.get()); }
+    const Function& function() const { return *static_cast<const Function*>(heap_.get()); }
+    const std::any& opaqueValue() const { return *static_cast<const std::any*>(heap_.get()); }
+
+    // obj.name et obj[key] ; null si absent
+    Value member(const std::string& name) const;
+    Value index(const Value& key) const;
+
+    // Égalité des templates (== et ===) : nombres par valeur, chaînes par contenu,
+    // composites par identité
+    bool equals(const Value& other) const;
+
+    template<typename T>
+    T as() const {
+        if constexpr (std::is_same_v<T, Value>) {
+            return *this;
+        } else if constexpr (std::is_same_v<T, bool>) {
+            return toBoolean();
+        } else if constexpr (std::is_integral_v<T>) {
+            return static_cast<T>(toInteger());
+        } else if constexpr (std::is_floating_point_v<T>) {
+            return static_cast<T>(toNumber());
+        } else if constexpr (std::is_same_v<T, std::string>) {
+            return toString();
+        } else if constexpr (std::is_same_v<T, std::any>) {
+            return toAny();
+        } else {
+            return std::any_cast<T>(toAny());
+        }
+    }
+
+private:
+    Type type_ = Type::NULL_VALUE;
+    union {
+        bool boolean_;
+        std::int64_t integer_;
+        double number_;
+    };
+    std::shared_ptr<const void> heap_;
+};
+
+} // namespace cppvue
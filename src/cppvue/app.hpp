@@ -1,12 +1,17 @@
 #pragma once
 
 #include "../core/component.hpp"
+#include "../core/component_table.hpp"
+#include "../core/hot_reload.hpp"
+#include "../core/module_loader.hpp"
 #include "../core/plugin.hpp"
 #include "../core/store.hpp"
 #include "../core/router.hpp"
 #include "../wasm/wasm_bridge.hpp"
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <string_view>
 
 namespace cppvue {
 
@@ -46,25 +51,36 @@ public:
         globalComponents_[name] = component;
     }
     
-    std::shared_ptr<Component> createComponent(const std::string& name) {
-        auto it = globalComponents_.find(name);
+    // Composants compilés d'abord (table installée par loadComponents(), sans
+    // allocation pour la recherche), puis composants globaux
+    std::shared_ptr<Component> createComponent(std::string_view name) {
+        if (const auto* table = ComponentTable::active()) {
+            if (auto id = table->idOf(name); id != ComponentTable::INVALID_ID) {
+                return table->create(id);
+            }
+        }
+        auto it = globalComponents_.find(std::string(name));
         if (it != globalComponents_.end()) {
             return it->second;
         }
         return nullptr;
     }
     
+    // Par identifiant (component_id:: du component_registry.hpp généré)
+    std::shared_ptr<Component> createComponent(std::uint32_t id) {
+        const auto* table = ComponentTable::active();
+        return table ? table->create(id) : nullptr;
+    }
+    
     // Gestion des directives globales
     void directive(const std::string& name, DirectiveHandler handler) {
         globalDirectives_[name] = handler;
     }
     
-    // Hot Reload
+    // Hot Reload : les instances vivantes de name sont re-rendues avec le
+    // dernier rendu enregistré, leur état est conservé
     void reloadComponent(const std::string& name) {
-        auto it = globalComponents_.find(name);
-        if (it != globalComponents_.end()) {
-            it->second->reload();
-        }
+        HotReload::instance().apply(name);
     }
     
     // Accès aux ressources partagées
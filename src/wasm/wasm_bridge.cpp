@@ -1,11 +1,55 @@
 #include "wasm_bridge.hpp"
 #include "../core/component.hpp"
+#include "../core/component_table.hpp"
 #include "../core/plugin.hpp"
+#include "../core/hot_reload.hpp"
+#include <dlfcn.h>
 #include <emscripten.h>
 #include <emscripten/bind.h>
 #include <emscripten/val.h>
 #include <nlohmann/json.hpp>
 
+// Parse le HTML dans un <template>, collecte les nœuds en ordre préfixe puis
+// insère le fragment : tout se fait côté JavaScript en un seul appel
+EM_JS(emscripten::EM_VAL, cppvue_insert_html, (emscripten::EM_VAL parentHandle,
+                                               emscripten::EM_VAL referenceHandle,
+                                               const char* html), {
+    const parent = Emval.toValue(parentHandle);
+    const reference = Emval.toValue(referenceHandle);
+    const template = document.createElement('template');
+    template.innerHTML = UTF8ToString(html);
+    const nodes = [];
+    const walker = document.createTreeWalker(
+        template.content, NodeFilter.SHOW_ELEMENT | NodeFilter.SHOW_TEXT);
+    while (walker.nextNode()) {
+        nodes.push(walker.currentNode);
+    }
+    parent.insertBefore(template.content, reference || null);
+    return Emval.toHandle(nodes);
+});
+
+// Retrait groupé des nœuds de premier niveau d'une insertion rejetée
+EM_JS(void, cppvue_remove_children, (emscripten::EM_VAL parentHandle, emscripten::EM_VAL nodesHandle), {
+    const parent = Emval.toValue(parentHandle);
+    for (const node of Emval.toValue(nodesHandle)) {
+        if (node.parentNode === parent) {
+            parent.removeChild(node);
+        }
+    }
+});
+
+// Clone le contenu d'un <template> et collecte les nœuds du clone en un seul appel
+EM_JS(emscripten::EM_VAL, cppvue_clone_template, (emscripten::EM_VAL templateHandle), {
+    const clone = Emval.toValue(templateHandle).content.cloneNode(true);
+    const nodes = [];
+    const walker = document.createTreeWalker(
+        clone, NodeFilter.SHOW_ELEMENT | NodeFilter.SHOW_TEXT);
+    while (walker.nextNode()) {
+        nodes.push(walker.currentNode);
+    }
+    return Emval.toHandle(nodes);
+});
+
 namespace cppvue::wasm {
 
 using json = nlohmann::json;
@@ -38,6 +82,35 @@ void JsBridge::removeAttribute(emscripten::val element, const std::string& name)
     element.call<void>("removeAttribute", name);
 }
 
+emscripten::val JsBridge::insertHTML(emscripten::val parent,
+                                   emscripten::val referenceNode,
+                                   const std::string& html) {
+    return emscripten::val::take_ownership(
+        cppvue_insert_html(parent.as_handle(), referenceNode.as_handle(), html.c_str()));
+}
+
+void JsBridge::removeChildren(emscripten::val parent, emscripten::val nodes) {
+    cppvue_remove_children(parent.as_handle(), nodes.as_handle());
+}
+
+emscripten::val JsBridge::createTemplate(const std::string& html) {
+    auto templateElement = createElement("template");
+    templateElement.set("innerHTML", html);
+    return templateElement;
+}
+
+emscripten::val JsBridge::cloneTemplate(emscripten::val templateElement) {
+    return emscripten::val::take_ownership(cppvue_clone_template(templateElement.as_handle()));
+}
+
+void JsBridge::setText(emscripten::val node, const std::string& text) {
+    node.set("nodeValue", text);
+}
+
+void JsBridge::setElementText(emscripten::val element, const std::string& text) {
+    element.set("textContent", text);
+}
+
 void JsBridge::addEventListener(emscripten::val element,
                               const std::string& event,
                               std::function<void(emscripten::val)> callback) {
@@ -263,15 +336,48 @@ void initializeWasm() {
     });
 }
 
+namespace {
+    // Instances créées depuis JavaScript, qui ne détient qu'un pointeur brut
+    std::unordered_map<Component*, std::shared_ptr<Component>>& liveComponents() {
+        static std::unordered_map<Component*, std::shared_ptr<Component>> components;
+        return components;
+    }
+
+    void* keepAlive(std::shared_ptr<Component> component) {
+        if (!component) {
+            return nullptr;
+        }
+        auto* pointer = component.get();
+        liveComponents()[pointer] = std::move(component);
+        return pointer;
+    }
+}
+
 void* createComponent(const char* name) {
     try {
-        auto component = App::instance().createComponent(name);
-        return component.get();
+        return keepAlive(App::instance().createComponent(std::string_view(name)));
+    } catch (const std::exception& e) {
+        return nullptr;
+    }
+}
+
+void* createComponentById(std::uint32_t id) {
+    try {
+        return keepAlive(App::instance().createComponent(id));
     } catch (const std::exception& e) {
         return nullptr;
     }
 }
 
+std::uint32_t componentId(const char* name) {
+    const auto* table = ComponentTable::active();
+    return table ? table->idOf(name) : ComponentTable::INVALID_ID;
+}
+
+void destroyComponent(void* component) {
+    liveComponents().erase(static_cast<Component*>(component));
+}
+
 void updateProps(void* component, const char* props) {
     if (!component) return;
     
@@ -304,13 +410,48 @@ void hotReload(const char* componentName) {
     }
 }
 
+namespace {
+    struct PendingHotModule {
+        std::string component;
+        std::size_t revision;
+    };
+
+    void hotModuleLoaded(void* userData, void* /*handle*/) {
+        std::unique_ptr<PendingHotModule> pending(static_cast<PendingHotModule*>(userData));
+        
+        // L'initialisation statique du module a enregistré le nouveau rendu, sauf
+        // si le script du composant a changé : seul un rechargement complet convient
+        if (HotReload::instance().revision(pending->component) == pending->revision) {
+            emscripten_run_script("location.reload()");
+            return;
+        }
+        hotReload(pending->component.c_str());
+    }
+
+    void hotModuleFailed(void* userData) {
+        delete static_cast<PendingHotModule*>(userData);
+        emscripten_run_script("location.reload()");
+    }
+}
+
+void loadHotModule(const char* path, const char* componentName) {
+    // Chargement asynchrone : la compilation synchrone d'un module wasm est
+    // limitée sur le thread principal du navigateur
+    auto* pending = new PendingHotModule{componentName, HotReload::instance().revision(componentName)};
+    emscripten_dlopen(path, RTLD_NOW, pending, &hotModuleLoaded, &hotModuleFailed);
+}
+
 // Binding Emscripten
 EMSCRIPTEN_BINDINGS(cppvue) {
     emscripten::function("initializeWasm", &initializeWasm);
     emscripten::function("createComponent", &createComponent);
+    emscripten::function("createComponentById", &createComponentById);
+    emscripten::function("componentId", &componentId);
+    emscripten::function("destroyComponent", &destroyComponent);
     emscripten::function("updateProps", &updateProps);
     emscripten::function("dispatchEvent", &dispatchEvent);
     emscripten::function("hotReload", &hotReload);
+    emscripten::function("loadHotModule", &loadHotModule);
 }
 
 } // namespace cppvue::wasm
@@ -2,6 +2,7 @@
 
 #include <emscripten/bind.h>
 #include <emscripten/val.h>
+#include <cstdint>
 #include <string>
 #include <functional>
 #include <memory>
@@ -24,6 +25,23 @@ public:
     void setAttribute(emscripten::val element, const std::string& name, const std::string& value);
     void removeAttribute(emscripten::val element, const std::string& name);
     
+    // Insère un fragment HTML en une traversée ; renvoie un tableau JS des nœuds
+    // élément/texte créés, en ordre préfixe
+    emscripten::val insertHTML(emscripten::val parent,
+                              emscripten::val referenceNode,
+                              const std::string& html);
+    // Retire de parent ceux des nœuds (tableau JS) qui en sont des enfants directs
+    void removeChildren(emscripten::val parent, emscripten::val nodes);
+    
+    // Squelettes statiques : <template> créé une fois, puis cloneNode(true) par instance.
+    // cloneTemplate renvoie un tableau JS des nœuds du clone en ordre préfixe
+    emscripten::val createTemplate(const std::string& html);
+    emscripten::val cloneTemplate(emscripten::val templateElement);
+    
+    // Text Content
+    void setText(emscripten::val node, const std::string& text);
+    void setElementText(emscripten::val element, const std::string& text);
+    
     // Event Handling
     void addEventListener(emscripten::val element, 
                         const std::string& event,
@@ -133,8 +151,12 @@ extern "C" {
     // Initialisation
     void EMSCRIPTEN_KEEPALIVE initializeWasm();
     
-    // Création de composants
+    // Création de composants : l'instance reste vivante jusqu'à destroyComponent.
+    // Les identifiants (componentId) évitent de passer des chaînes par le bridge
     void* EMSCRIPTEN_KEEPALIVE createComponent(const char* name);
+    void* EMSCRIPTEN_KEEPALIVE createComponentById(std::uint32_t id);
+    std::uint32_t EMSCRIPTEN_KEEPALIVE componentId(const char* name);
+    void EMSCRIPTEN_KEEPALIVE destroyComponent(void* component);
     
     // Mise à jour des props
     void EMSCRIPTEN_KEEPALIVE updateProps(void* component, const char* props);
@@ -142,8 +164,10 @@ extern "C" {
     // Gestion des événements
     void EMSCRIPTEN_KEEPALIVE dispatchEvent(void* component, const char* event, const char* data);
     
-    // Hot Reload
+    // Hot Reload : re-rend les instances de componentName avec le dernier rendu
+    // chargé ; loadHotModule charge d'abord le module écrit dans le FS par le client
     void EMSCRIPTEN_KEEPALIVE hotReload(const char* componentName);
+    void EMSCRIPTEN_KEEPALIVE loadHotModule(const char* path, const char* componentName);
 }
 
 } // namespace cppvue::wasm
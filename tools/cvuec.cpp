@@ -0,0 +1,226 @@
+// cvuec : compile les composants .cvue d'un projet en C++
+//
+//   cvuec [-j N] [--project NAME] [--hot-reload] [--watch] [--minify-css]
+//         [--hot-port N] [--hot-module-cmd CMD] [--pch] [--unity N]
+//         [--compact] [--size-report] [--daemon SOCKET] [--time-trace FILE]
+//         [--chunk NAME=Comp1,Comp2]... [--lazy-chunks] <sourceDir> <buildDir>
+//   cvuec --connect SOCKET [fichier...]
+
+#include "compiler/build_tool.hpp"
+#include "compiler/compiler_daemon.hpp"
+#include "compiler/file_io.hpp"
+#include "compiler/phase_profiler.hpp"
+#include <csignal>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <pthread.h>
+
+namespace {
+    // Composants listés dans le résumé de --time-trace
+    constexpr std::size_t TIME_TRACE_TOP = 10;
+
+    void printUsage() {
+        std::cerr << "usage: cvuec [-j N] [--project NAME] [--hot-reload] [--watch] [--minify-css]\n"
+                     "             [--hot-port N] [--hot-module-cmd CMD] [--pch] [--unity N]\n"
+                     "             [--compact] [--size-report] [--daemon SOCKET] [--time-trace FILE]\n"
+                     "             [--chunk NAME=Comp1,Comp2]... [--lazy-chunks] <sourceDir> <buildDir>\n"
+                     "       cvuec --connect SOCKET [file...]\n";
+    }
+
+    // Client : fait recompiler ces fichiers (ou tout le projet) par le daemon
+    int requestDaemon(const std::string& socketPath, const std::vector<std::string>& files) {
+        std::string request = "compile";
+        for (std::size_t i = 0; i < files.size(); ++i) {
+            request += (i == 0 ? " " : "\t") + files[i];
+        }
+        std::string response = cppvue::compiler::CompilerDaemonClient::request(socketPath, request);
+        std::cout << response;
+        return response.find("error ") == 0 || response.find("\nerror ") != std::string::npos ? 1 : 0;
+    }
+}
+
+int main(int argc, char** argv) {
+    cppvue::compiler::BuildConfig config;
+    config.projectName = "app";
+    std::vector<std::string> positional;
+    bool watch = false;
+    std::string daemonSocket;
+    std::string connectSocket;
+    std::string timeTraceFile;
+    bool sizeReport = false;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "-j" && i + 1 < argc) {
+            config.jobs = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (arg.rfind("-j", 0) == 0 && arg.size() > 2) {
+            config.jobs = static_cast<unsigned>(std::strtoul(arg.c_str() + 2, nullptr, 10));
+        } else if (arg == "--project" && i + 1 < argc) {
+            config.projectName = argv[++i];
+        } else if (arg == "--hot-reload") {
+            config.enableHotReload = true;
+        } else if (arg == "--hot-port" && i + 1 < argc) {
+            config.hotReloadPort = static_cast<std::uint16_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (arg == "--hot-module-cmd" && i + 1 < argc) {
+            // --hot-module-cmd "cmake --build out --target hot_{name}"
+            config.hotModuleCommand = argv[++i];
+        } else if (arg == "--pch") {
+            config.precompiledHeaders = true;
+        } else if (arg == "--unity" && i + 1 < argc) {
+            // --unity 16 : 16 composants par unité de compilation
+            config.unityBatchSize = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--compact") {
+            // Sous-arbres et attributs statiques en blobs partagés entre composants
+            config.compactCode = true;
+        } else if (arg == "--size-report") {
+            sizeReport = true;
+        } else if (arg == "--minify-css") {
+            config.minifyCss = true;
+        } else if (arg == "--chunk" && i + 1 < argc) {
+            // --chunk admin=AdminPage,UserTable : CSS de ces composants dans css/admin.css
+            std::string spec = argv[++i];
+            auto equals = spec.find('=');
+            if (equals == std::string::npos || equals == 0) {
+                std::cerr << "cvuec: invalid --chunk " << spec << "\n";
+                return 2;
+            }
+            auto& names = config.routeChunks[spec.substr(0, equals)];
+            for (std::size_t start = equals + 1; start <= spec.size();) {
+                auto comma = std::min(spec.find(',', start), spec.size());
+                if (comma > start) {
+                    names.push_back(spec.substr(start, comma - start));
+                }
+                start = comma + 1;
+            }
+        } else if (arg == "--lazy-chunks") {
+            // Composants des chunks compilés en modules chargés à la première navigation
+            config.lazyChunks = true;
+        } else if (arg == "--watch") {
+            watch = true;
+        } else if (arg == "--daemon" && i + 1 < argc) {
+            daemonSocket = argv[++i];
+        } else if (arg == "--connect" && i + 1 < argc) {
+            connectSocket = argv[++i];
+        } else if (arg == "--time-trace" && i + 1 < argc) {
+            // --time-trace trace.json : à ouvrir dans Perfetto ou chrome://tracing
+            timeTraceFile = argv[++i];
+            config.timeTrace = true;
+        } else if (arg == "-h" || arg == "--help") {
+            printUsage();
+            return 0;
+        } else if (!arg.empty() && arg[0] == '-') {
+            std::cerr << "cvuec: unknown option " << arg << "\n";
+            printUsage();
+            return 2;
+        } else {
+            positional.push_back(arg);
+        }
+    }
+
+    if (!connectSocket.empty()) {
+        try {
+            return requestDaemon(connectSocket, positional);
+        } catch (const std::exception& e) {
+            std::cerr << "cvuec: " << e.what() << "\n";
+            return 1;
+        }
+    }
+
+    if (positional.size() != 2) {
+        printUsage();
+        return 2;
+    }
+
+    config.sourceDir = positional[0];
+    config.buildDir = positional[1];
+    config.outputDir = config.buildDir;
+
+    // Bloqués avant la création des threads, pour que seul sigwait les reçoive
+    sigset_t stopSignals;
+    sigemptyset(&stopSignals);
+    sigaddset(&stopSignals, SIGINT);
+    sigaddset(&stopSignals, SIGTERM);
+    bool persistent = watch || !daemonSocket.empty();
+    if (persistent) {
+        pthread_sigmask(SIG_BLOCK, &stopSignals, nullptr);
+        config.keepGeneratedCode = true;
+        cppvue::compiler::MappedFile::setMappingEnabled(false);
+    }
+
+    auto& profiler = cppvue::compiler::PhaseProfiler::instance();
+    if (!timeTraceFile.empty()) {
+        profiler.start();
+    }
+
+    int status = 0;
+    try {
+        // En mode daemon, l'outil de build appartient au daemon
+        std::unique_ptr<cppvue::compiler::CompilerDaemon> daemon;
+        std::unique_ptr<cppvue::compiler::BuildTool> ownTool;
+        if (!daemonSocket.empty()) {
+            daemon = std::make_unique<cppvue::compiler::CompilerDaemon>(daemonSocket, config);
+        } else {
+            ownTool = std::make_unique<cppvue::compiler::BuildTool>(config);
+        }
+        auto& tool = daemon ? daemon->buildTool() : *ownTool;
+        tool.generateBuildFiles();
+        
+        // Avant le build : échoue tout de suite si un daemon tient déjà la socket
+        // (les requêtes reçues pendant le build attendent sa fin)
+        if (daemon) {
+            daemon->start();
+        }
+        try {
+            tool.buildComponents();
+        } catch (const cppvue::compiler::BuildError& e) {
+            // En mode watch ou daemon, les composants en erreur seront recompilés plus tard
+            if (!persistent) {
+                throw;
+            }
+            std::cerr << "cvuec: " << e.what() << "\n";
+        }
+        if (sizeReport) {
+            std::cout << tool.codeSizeReport();
+        }
+
+        if (watch) {
+            tool.watchAndRebuild();
+            std::cerr << "cvuec: watching " << config.sourceDir.string() << " (Ctrl-C to stop)\n";
+        }
+        if (daemon) {
+            std::cerr << "cvuec: compiler daemon listening on " << daemonSocket << " (Ctrl-C to stop)\n";
+            
+            // Jusqu'à un signal ou une requête shutdown
+            timespec interval{0, 200 * 1000 * 1000};
+            while (daemon->running() && sigtimedwait(&stopSignals, nullptr, &interval) < 0) {
+            }
+            daemon->stop();
+        } else if (watch) {
+            int signal = 0;
+            sigwait(&stopSignals, &signal);
+        }
+        if (watch) {
+            tool.stopWatching();
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "cvuec: " << e.what() << "\n";
+        status = 1;
+    }
+
+    // Écrit aussi en cas d'échec : les phases déjà passées restent utiles
+    if (!timeTraceFile.empty()) {
+        profiler.stop();
+        std::cerr << profiler.summary(TIME_TRACE_TOP);
+        if (!profiler.writeChromeTrace(timeTraceFile)) {
+            std::cerr << "cvuec: cannot write " << timeTraceFile << "\n";
+            status = 1;
+        }
+    }
+
+    return status;
+}